@@ -14,11 +14,89 @@
  *
  ******************************************************************************/
 
+#include <stdarg.h>
 #include "sl_bt_ncp_host.h"
+#include "sl_bt_ncp_host_cmd.h"
+#include "sl_bt_ncp_trace.h"
 #include "sl_status.h"
 
-extern sl_bt_msg_t*  sl_bt_cmd_msg;
-extern sl_bt_msg_t*  sl_bt_rsp_msg;
+// copy len bytes starting at offset off of the two receive runs
+static void sl_bt_view_copy(uint8_t *dst, uint32_t off, uint32_t len,
+                            const uint8_t *pt1, uint32_t len1, const uint8_t *pt2)
+{
+  uint32_t n;
+  if (off < len1) {
+    n = len1 - off;
+    if (n > len) {
+      n = len;
+    }
+    memcpy(dst, &pt1[off], n);
+    dst += n;
+    len -= n;
+    off = len1;
+  }
+  memcpy(dst, &pt2[off - len1], len);
+}
+
+// sl_bt_wait_message when the receive buffer can be read in place
+static sl_bt_msg_t* sl_bt_wait_message_view(void)
+{
+  const uint8_t *pt1, *pt2;
+  uint32_t len1, len2, avail;
+  uint32_t msg_length;
+  uint32_t header;
+  sl_bt_msg_t *pck, *retVal = NULL;
+  //sync to header byte, checked where it lies
+  while ((avail = sl_bt_api_view(&pt1, &len1, &pt2, &len2)) == 0) {
+  }
+  if ((pt1[0] & 0x78) != sl_bt_dev_type_default) {
+    sl_bt_api_commit(1);
+    return 0;
+  }
+  while (avail < SL_BT_MSG_HEADER_LEN) {
+    avail = sl_bt_api_view(&pt1, &len1, &pt2, &len2);
+  }
+  sl_bt_view_copy((uint8_t*)&header, 0, SL_BT_MSG_HEADER_LEN, pt1, len1, pt2);
+
+  SL_BT_TRACE(header);
+  msg_length = SL_BT_MSG_LEN(header);
+
+  if (msg_length > SL_BT_MAX_PAYLOAD_SIZE) {
+    sl_bt_api_commit(SL_BT_MSG_HEADER_LEN);
+    return 0;
+  }
+  if ((header & 0xf8) == (sl_bt_dev_type_default | sl_bt_msg_type_evt)) {
+    //received event
+    pck = &sl_bt_queue[sl_bt_queue_w];
+  } else if ((header & 0xf8) == sl_bt_dev_type_default) {//response
+    retVal = pck = sl_bt_rsp_msg;
+  } else {
+    //fail
+    sl_bt_api_commit(SL_BT_MSG_HEADER_LEN);
+    return 0;
+  }
+  //take the frame only once all of it has arrived
+  while (avail < SL_BT_MSG_HEADER_LEN + msg_length) {
+    avail = sl_bt_api_view(&pt1, &len1, &pt2, &len2);
+  }
+  if (retVal == NULL) {
+    if ((sl_bt_queue_w + 1) % SL_BT_API_QUEUE_LEN == sl_bt_queue_r) {
+      //drop packet, released without reading it
+      sl_bt_api_commit(SL_BT_MSG_HEADER_LEN + msg_length);
+      return 0;      //NO ROOM IN QUEUE
+    }
+    sl_bt_queue_w = (sl_bt_queue_w + 1) % SL_BT_API_QUEUE_LEN;
+  }
+  pck->header = header;
+  if (msg_length) {
+    sl_bt_view_copy((uint8_t*)&pck->data.payload, SL_BT_MSG_HEADER_LEN, msg_length,
+                    pt1, len1, pt2);
+  }
+  sl_bt_api_commit(SL_BT_MSG_HEADER_LEN + msg_length);
+
+  // Using retVal avoid double handling of event msg types in outer function
+  return retVal;
+}
 
 sl_bt_msg_t* sl_bt_wait_message(void)//wait for event from system
 {
@@ -27,6 +105,9 @@ sl_bt_msg_t* sl_bt_wait_message(void)//wait for event from system
   uint8_t  *payload;
   sl_bt_msg_t *pck, *retVal = NULL;
   int      ret;
+  if (sl_bt_api_view) {
+    return sl_bt_wait_message_view();
+  }
   //sync to header byte
   ret = sl_bt_api_input(1, (uint8_t*)&header);
   if (ret < 0 || (header & 0x78) != sl_bt_dev_type_default) {
@@ -37,6 +118,7 @@ sl_bt_msg_t* sl_bt_wait_message(void)//wait for event from system
     return 0;
   }
 
+  SL_BT_TRACE(header);
   msg_length = SL_BT_MSG_LEN(header);
 
   if (msg_length > SL_BT_MAX_PAYLOAD_SIZE) {
@@ -137,6 +219,7 @@ sl_bt_msg_t* sl_bt_wait_response(void)
 void sl_bt_host_handle_command()
 {
   //packet in sl_bt_cmd_msg is waiting for output
+  SL_BT_TRACE(sl_bt_cmd_msg->header | SL_BT_TRACE_TX);
   sl_bt_api_output(SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(sl_bt_cmd_msg->header), (uint8_t*)sl_bt_cmd_msg);
   sl_bt_wait_response();
 }
@@ -144,5 +227,94 @@ void sl_bt_host_handle_command()
 void sl_bt_host_handle_command_noresponse()
 {
   //packet in sl_bt_cmd_msg is waiting for output
+  SL_BT_TRACE(sl_bt_cmd_msg->header | SL_BT_TRACE_TX);
   sl_bt_api_output(SL_BT_MSG_HEADER_LEN + SL_BT_MSG_LEN(sl_bt_cmd_msg->header), (uint8_t*)sl_bt_cmd_msg);
 }
+
+sl_status_t sl_bt_host_command(uint32_t id, const char *layout, ...)
+{
+  va_list  ap;
+  uint8_t  *p = (uint8_t*)&sl_bt_cmd_msg->data.payload;
+  uint32_t value, len;
+  bd_addr  address;
+  const uint8_t *data;
+  uint8_t  *out;
+  size_t   max_size;
+  uint16_t result;
+
+  va_start(ap, layout);
+  //pack command fields, little endian like the packed sli_bt_api.h structs
+  for (; *layout && *layout != '>'; layout++) {
+    switch (*layout) {
+      case 'b':
+        *p++ = (uint8_t)va_arg(ap, int);
+        break;
+      case 'h':
+        value = (uint32_t)va_arg(ap, int);
+        *p++ = (uint8_t)value;
+        *p++ = (uint8_t)(value >> 8);
+        break;
+      case 'w':
+        value = va_arg(ap, uint32_t);
+        memcpy(p, &value, 4);
+        p += 4;
+        break;
+      case 'a':
+        address = va_arg(ap, bd_addr);
+        memcpy(p, &address, sizeof(bd_addr));
+        p += sizeof(bd_addr);
+        break;
+      case 'A':
+        len = (uint32_t)va_arg(ap, size_t);
+        data = va_arg(ap, const uint8_t*);
+        *p++ = (uint8_t)len;
+        memcpy(p, data, len);
+        p += len;
+        break;
+    }
+  }
+  len = p - (uint8_t*)&sl_bt_cmd_msg->data.payload;
+  sl_bt_cmd_msg->header = id + ((len & 0xff) << 8) + ((len & 0x700) >> 8);
+
+  if (*layout != '>') {
+    sl_bt_host_handle_command_noresponse();
+    va_end(ap);
+    return SL_STATUS_OK;
+  }
+  sl_bt_host_handle_command();
+
+  //unpack response fields after result into the caller's pointers
+  p = (uint8_t*)&sl_bt_rsp_msg->data.payload;
+  result = (uint16_t)(p[0] | (p[1] << 8));
+  p += 2;
+  for (layout++; *layout; layout++) {
+    switch (*layout) {
+      case 'b':
+        *va_arg(ap, uint8_t*) = *p++;
+        break;
+      case 'h':
+        memcpy(va_arg(ap, uint16_t*), p, 2);
+        p += 2;
+        break;
+      case 'w':
+        memcpy(va_arg(ap, uint32_t*), p, 4);
+        p += 4;
+        break;
+      case 'a':
+        memcpy(va_arg(ap, bd_addr*), p, sizeof(bd_addr));
+        p += sizeof(bd_addr);
+        break;
+      case 'A':
+        max_size = va_arg(ap, size_t);
+        *va_arg(ap, size_t*) = *p;
+        out = va_arg(ap, uint8_t*);
+        if (*p <= max_size) {
+          memcpy(out, p + 1, *p);
+        }
+        p += 1 + *p;
+        break;
+    }
+  }
+  va_end(ap);
+  return result;
+}
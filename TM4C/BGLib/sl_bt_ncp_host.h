@@ -92,28 +92,76 @@
 #define SL_BT_API_QUEUE_LEN 30
 #endif
 
+#ifndef SL_BT_API_MULTI
+#define SL_BT_API_MULTI 0
+#endif
+
+/*****************************************************************************
+ *
+ *  All host state lives in a sl_bt_ncp_ctx_t, one per NCP radio.
+ *
+ *  Single radio (default): SL_BT_API_DEFINE() creates sl_bt_default_ctx and
+ *  every command and event function uses it directly, at a fixed address.
+ *
+ *  Several radios: compile with SL_BT_API_MULTI=1, define one context per
+ *  radio and bind the one to use before calling any sl_bt_* function:
+ *      SL_BT_API_DEFINE();                        // radio 0, UART1
+ *      sl_bt_ncp_ctx_t scanner;                   // radio 1, another UART
+ *      SL_BT_API_CTX_INITIALIZE_NONBLOCK(&scanner, out2, in2, peek2);
+ *      SL_BT_API_BIND(&scanner);
+ *      sl_bt_scanner_start(1, 1);
+ *      SL_BT_API_BIND(&sl_bt_default_ctx);
+ *  Binding is one pointer write; a command runs to completion on the context
+ *  that was bound when it started, so bind from one thread only.
+ *
+ ****************************************************************************/
+typedef struct sl_bt_ncp_ctx {
+  sl_bt_msg_t cmd_msg;                             // command being sent
+  sl_bt_msg_t rsp_msg;                             // last response
+  void (*output)(uint32_t len1, uint8_t* data1);   // write to the radio
+  int32_t (*input)(uint32_t len1, uint8_t* data1); // read from the radio
+  int32_t (*peek)(void);                           // bytes waiting, or NULL
+  uint32_t (*view)(const uint8_t **pt1, uint32_t *len1,
+                   const uint8_t **pt2, uint32_t *len2); // bytes in place, or NULL
+  void (*commit)(uint32_t len);                    // release bytes seen by view
+  sl_bt_msg_t queue[SL_BT_API_QUEUE_LEN];          // events read while waiting for a response
+  int    queue_w;
+  int    queue_r;
+} sl_bt_ncp_ctx_t;
+
+extern sl_bt_ncp_ctx_t sl_bt_default_ctx;
+
+#if SL_BT_API_MULTI
+extern sl_bt_ncp_ctx_t *sl_bt_ctx;
+#define SL_BT_API_DEFINE()                                   \
+  sl_bt_ncp_ctx_t sl_bt_default_ctx;                         \
+  sl_bt_ncp_ctx_t *sl_bt_ctx = &sl_bt_default_ctx;
+#define SL_BT_API_BIND(CTX) (sl_bt_ctx = (CTX))
+#else
+#define sl_bt_ctx (&sl_bt_default_ctx)
 #define SL_BT_API_DEFINE()                                   \
-  sl_bt_msg_t _sl_bt_cmd_msg;                                \
-  sl_bt_msg_t _sl_bt_rsp_msg;                                \
-  sl_bt_msg_t *sl_bt_cmd_msg = &_sl_bt_cmd_msg;              \
-  sl_bt_msg_t *sl_bt_rsp_msg = &_sl_bt_rsp_msg;              \
-  void (*sl_bt_api_output)(uint32_t len1, uint8_t* data1);   \
-  int32_t (*sl_bt_api_input)(uint32_t len1, uint8_t* data1); \
-  int32_t (*sl_bt_api_peek)(void);                           \
-  sl_bt_msg_t sl_bt_queue[SL_BT_API_QUEUE_LEN];              \
-  int    sl_bt_queue_w = 0;                                  \
-  int    sl_bt_queue_r = 0;
-
-extern sl_bt_msg_t sl_bt_queue[SL_BT_API_QUEUE_LEN];
-extern int    sl_bt_queue_w;
-extern int    sl_bt_queue_r;
+  sl_bt_ncp_ctx_t sl_bt_default_ctx;
+#define SL_BT_API_BIND(CTX)
+#endif
+
+// names used by the adaptation layer, all resolve to the bound context
+#define sl_bt_cmd_msg    (&sl_bt_ctx->cmd_msg)
+#define sl_bt_rsp_msg    (&sl_bt_ctx->rsp_msg)
+#define sl_bt_api_output (sl_bt_ctx->output)
+#define sl_bt_api_input  (sl_bt_ctx->input)
+#define sl_bt_api_peek   (sl_bt_ctx->peek)
+#define sl_bt_api_view   (sl_bt_ctx->view)
+#define sl_bt_api_commit (sl_bt_ctx->commit)
+#define sl_bt_queue      (sl_bt_ctx->queue)
+#define sl_bt_queue_w    (sl_bt_ctx->queue_w)
+#define sl_bt_queue_r    (sl_bt_ctx->queue_r)
 
 /**
  * Initialize SL_BT_API
  * @param OFUNC
  * @param IFUNC
  */
-#define SL_BT_API_INITIALIZE(OFUNC, IFUNC) sl_bt_api_output = OFUNC; sl_bt_api_input = IFUNC; sl_bt_api_peek = NULL;
+#define SL_BT_API_INITIALIZE(OFUNC, IFUNC) sl_bt_api_output = OFUNC; sl_bt_api_input = IFUNC; sl_bt_api_peek = NULL; sl_bt_api_view = NULL;
 
 /**
  * Initialize SL_BT_API to support nonblocking mode
@@ -121,11 +169,30 @@ extern int    sl_bt_queue_r;
  * @param IFUNC
  * @param PFUNC peek function to check if there is data to be read from UART
  */
-#define SL_BT_API_INITIALIZE_NONBLOCK(OFUNC, IFUNC, PFUNC) sl_bt_api_output = OFUNC; sl_bt_api_input = IFUNC; sl_bt_api_peek = PFUNC;
+#define SL_BT_API_INITIALIZE_NONBLOCK(OFUNC, IFUNC, PFUNC) sl_bt_api_output = OFUNC; sl_bt_api_input = IFUNC; sl_bt_api_peek = PFUNC; sl_bt_api_view = NULL;
+
+/**
+ * Let SL_BT_API parse messages in place in the receive buffer
+ * Use after SL_BT_API_INITIALIZE or SL_BT_API_INITIALIZE_NONBLOCK. The
+ * header is checked where it lies, a frame is only taken once it has
+ * fully arrived, and dropped events are released without being copied.
+ * @param VFUNC returns the unread bytes as up to two runs, e.g. UART1_RxView
+ * @param CFUNC releases parsed bytes, e.g. UART1_RxCommit
+ */
+#define SL_BT_API_INITIALIZE_ZEROCOPY(VFUNC, CFUNC) sl_bt_api_view = VFUNC; sl_bt_api_commit = CFUNC;
+
+/**
+ * Initialize an additional context (SL_BT_API_MULTI)
+ * @param CTX   context to set up, its event queue starts empty
+ * @param OFUNC
+ * @param IFUNC
+ * @param PFUNC peek function, or NULL for blocking mode
+ */
+#define SL_BT_API_CTX_INITIALIZE_NONBLOCK(CTX, OFUNC, IFUNC, PFUNC) \
+  (CTX)->output = OFUNC; (CTX)->input = IFUNC; (CTX)->peek = PFUNC; \
+  (CTX)->view = NULL; (CTX)->commit = NULL;                         \
+  (CTX)->queue_w = 0; (CTX)->queue_r = 0;
 
-extern void(*sl_bt_api_output)(uint32_t len1, uint8_t* data1);
-extern int32_t (*sl_bt_api_input)(uint32_t len1, uint8_t* data1);
-extern int32_t(*sl_bt_api_peek)(void);
 void sl_bt_host_handle_command();
 void sl_bt_host_handle_command_noresponse();
 
@@ -0,0 +1,39 @@
+/***************************************************************************//**
+ * @brief Table-driven SL_BT_API command serializer for the NCP host
+ ******************************************************************************/
+
+#ifndef SL_BT_NCP_HOST_CMD_H
+#define SL_BT_NCP_HOST_CMD_H
+
+#include "sl_bt_api.h"
+
+/*****************************************************************************
+ *
+ *  Every sl_bt_* command in sl_bt_ncp_host_api.c is a one-line call to
+ *  sl_bt_host_command() with the command ID and a layout string taken from
+ *  sl_bt_ncp_host_table.h. Both files are generated by tools/sl_bt_ncp_gen.py
+ *  from the packed structures in sli_bt_api.h.
+ *
+ *  Layout codes, one per packed field, in wire order:
+ *      b   8-bit value        (argument: any integer type)
+ *      h   16-bit value       (argument: any integer type)
+ *      w   32-bit value       (argument: any integer type)
+ *      a   bd_addr            (argument: bd_addr by value)
+ *      A   uint8array, last   (arguments: size_t len, const uint8_t *data)
+ *      >   end of the command; the fields after it are the response fields
+ *          that follow "result", each written through a pointer argument
+ *          (A takes size_t max_size, size_t *len, uint8_t *data)
+ *  A layout without '>' is sent without waiting for a response.
+ *
+ ****************************************************************************/
+
+/**
+ * Pack a command into sl_bt_cmd_msg, send it, and unpack the response
+ * @param id     sl_bt_cmd_*_id
+ * @param layout layout string, see above
+ * @param ...    the sl_bt_* function parameters, in order
+ * @return result field of the response, SL_STATUS_OK if there is none
+ */
+sl_status_t sl_bt_host_command(uint32_t id, const char *layout, ...);
+
+#endif
@@ -0,0 +1,155 @@
+// sl_bt_ncp_host_table.h
+// Generated by tools/sl_bt_ncp_gen.py from sl_bt_api.h, sl_bt_types.h and
+// sli_bt_api.h, do not edit.
+// One SL_BT_CMD(name, id, layout) entry per NCP command, layout codes are
+// described in sl_bt_ncp_host_cmd.h. Define SL_BT_CMD before expanding
+// SL_BT_CMD_TABLE, e.g. to build name or layout lookup tables.
+
+#ifndef SL_BT_NCP_HOST_TABLE_H
+#define SL_BT_NCP_HOST_TABLE_H
+
+#define SL_BT_CMD_TABLE \
+  SL_BT_CMD(dfu_reset,                                   0x00000020, "b") \
+  SL_BT_CMD(dfu_flash_set_address,                       0x01000020, "w>") \
+  SL_BT_CMD(dfu_flash_upload,                            0x02000020, "A>") \
+  SL_BT_CMD(dfu_flash_upload_finish,                     0x03000020, ">") \
+  SL_BT_CMD(system_hello,                                0x00010020, ">") \
+  SL_BT_CMD(system_reset,                                0x01010020, "b") \
+  SL_BT_CMD(system_halt,                                 0x0c010020, "b>") \
+  SL_BT_CMD(system_linklayer_configure,                  0x0e010020, "bA>") \
+  SL_BT_CMD(system_set_max_tx_power,                     0x16010020, "h>h") \
+  SL_BT_CMD(system_set_identity_address,                 0x13010020, "ab>") \
+  SL_BT_CMD(system_get_identity_address,                 0x15010020, ">ab") \
+  SL_BT_CMD(system_get_random_data,                      0x0b010020, "b>A") \
+  SL_BT_CMD(system_data_buffer_write,                    0x12010020, "A>") \
+  SL_BT_CMD(system_data_buffer_clear,                    0x14010020, ">") \
+  SL_BT_CMD(system_get_counters,                         0x0f010020, "b>hhhh") \
+  SL_BT_CMD(system_set_soft_timer,                       0x19010020, "wbb>") \
+  SL_BT_CMD(system_set_lazy_soft_timer,                  0x1a010020, "wwbb>") \
+  SL_BT_CMD(gap_set_privacy_mode,                        0x01020020, "bb>") \
+  SL_BT_CMD(gap_set_data_channel_classification,         0x02020020, "A>") \
+  SL_BT_CMD(gap_enable_whitelisting,                     0x03020020, "b>") \
+  SL_BT_CMD(advertiser_create_set,                       0x01040020, ">b") \
+  SL_BT_CMD(advertiser_set_timing,                       0x03040020, "bwwhb>") \
+  SL_BT_CMD(advertiser_set_phy,                          0x06040020, "bbb>") \
+  SL_BT_CMD(advertiser_set_channel_map,                  0x04040020, "bb>") \
+  SL_BT_CMD(advertiser_set_tx_power,                     0x0b040020, "bh>h") \
+  SL_BT_CMD(advertiser_set_report_scan_request,          0x05040020, "bb>") \
+  SL_BT_CMD(advertiser_set_random_address,               0x10040020, "bba>a") \
+  SL_BT_CMD(advertiser_clear_random_address,             0x11040020, "b>") \
+  SL_BT_CMD(advertiser_set_configuration,                0x07040020, "bw>") \
+  SL_BT_CMD(advertiser_clear_configuration,              0x08040020, "bw>") \
+  SL_BT_CMD(advertiser_set_data,                         0x0f040020, "bbA>") \
+  SL_BT_CMD(advertiser_set_long_data,                    0x0e040020, "bb>") \
+  SL_BT_CMD(advertiser_start,                            0x09040020, "bbb>") \
+  SL_BT_CMD(advertiser_stop,                             0x0a040020, "b>") \
+  SL_BT_CMD(advertiser_start_periodic_advertising,       0x0c040020, "bhhw>") \
+  SL_BT_CMD(advertiser_stop_periodic_advertising,        0x0d040020, "b>") \
+  SL_BT_CMD(advertiser_delete_set,                       0x02040020, "b>") \
+  SL_BT_CMD(scanner_set_timing,                          0x01050020, "bhh>") \
+  SL_BT_CMD(scanner_set_mode,                            0x02050020, "bb>") \
+  SL_BT_CMD(scanner_start,                               0x03050020, "bb>") \
+  SL_BT_CMD(scanner_stop,                                0x05050020, ">") \
+  SL_BT_CMD(sync_set_parameters,                         0x02420020, "hhw>") \
+  SL_BT_CMD(sync_open,                                   0x00420020, "abb>h") \
+  SL_BT_CMD(sync_close,                                  0x01420020, "h>") \
+  SL_BT_CMD(connection_set_default_parameters,           0x00060020, "hhhhhh>") \
+  SL_BT_CMD(connection_set_default_preferred_phy,        0x01060020, "bb>") \
+  SL_BT_CMD(connection_open,                             0x04060020, "abb>b") \
+  SL_BT_CMD(connection_set_parameters,                   0x06060020, "bhhhhhh>") \
+  SL_BT_CMD(connection_set_preferred_phy,                0x08060020, "bbb>") \
+  SL_BT_CMD(connection_disable_slave_latency,            0x03060020, "bb>") \
+  SL_BT_CMD(connection_get_rssi,                         0x02060020, "b>") \
+  SL_BT_CMD(connection_read_channel_map,                 0x07060020, "b>A") \
+  SL_BT_CMD(connection_close,                            0x05060020, "b>") \
+  SL_BT_CMD(gatt_set_max_mtu,                            0x00090020, "h>h") \
+  SL_BT_CMD(gatt_discover_primary_services,              0x01090020, "b>") \
+  SL_BT_CMD(gatt_discover_primary_services_by_uuid,      0x02090020, "bA>") \
+  SL_BT_CMD(gatt_find_included_services,                 0x10090020, "bw>") \
+  SL_BT_CMD(gatt_discover_characteristics,               0x03090020, "bw>") \
+  SL_BT_CMD(gatt_discover_characteristics_by_uuid,       0x04090020, "bwA>") \
+  SL_BT_CMD(gatt_discover_descriptors,                   0x06090020, "bh>") \
+  SL_BT_CMD(gatt_set_characteristic_notification,        0x05090020, "bhb>") \
+  SL_BT_CMD(gatt_send_characteristic_confirmation,       0x0d090020, "b>") \
+  SL_BT_CMD(gatt_read_characteristic_value,              0x07090020, "bh>") \
+  SL_BT_CMD(gatt_read_characteristic_value_from_offset,  0x12090020, "bhhh>") \
+  SL_BT_CMD(gatt_read_multiple_characteristic_values,    0x11090020, "bA>") \
+  SL_BT_CMD(gatt_read_characteristic_value_by_uuid,      0x08090020, "bwA>") \
+  SL_BT_CMD(gatt_write_characteristic_value,             0x09090020, "bhA>") \
+  SL_BT_CMD(gatt_write_characteristic_value_without_response, 0x0a090020, "bhA>h") \
+  SL_BT_CMD(gatt_prepare_characteristic_value_write,     0x0b090020, "bhhA>h") \
+  SL_BT_CMD(gatt_prepare_characteristic_value_reliable_write, 0x13090020, "bhhA>h") \
+  SL_BT_CMD(gatt_execute_characteristic_value_write,     0x0c090020, "bb>") \
+  SL_BT_CMD(gatt_read_descriptor_value,                  0x0e090020, "bh>") \
+  SL_BT_CMD(gatt_write_descriptor_value,                 0x0f090020, "bhA>") \
+  SL_BT_CMD(gatt_server_set_capabilities,                0x080a0020, "ww>") \
+  SL_BT_CMD(gatt_server_enable_capabilities,             0x0c0a0020, "w>") \
+  SL_BT_CMD(gatt_server_disable_capabilities,            0x0d0a0020, "w>") \
+  SL_BT_CMD(gatt_server_get_enabled_capabilities,        0x0e0a0020, ">w") \
+  SL_BT_CMD(gatt_server_set_max_mtu,                     0x0a0a0020, "h>h") \
+  SL_BT_CMD(gatt_server_get_mtu,                         0x0b0a0020, "b>h") \
+  SL_BT_CMD(gatt_server_find_attribute,                  0x060a0020, "hA>h") \
+  SL_BT_CMD(gatt_server_read_attribute_value,            0x000a0020, "hh>A") \
+  SL_BT_CMD(gatt_server_read_attribute_type,             0x010a0020, "h>A") \
+  SL_BT_CMD(gatt_server_write_attribute_value,           0x020a0020, "hhA>") \
+  SL_BT_CMD(gatt_server_send_user_read_response,         0x030a0020, "bhbA>h") \
+  SL_BT_CMD(gatt_server_send_user_write_response,        0x040a0020, "bhb>") \
+  SL_BT_CMD(gatt_server_send_characteristic_notification, 0x050a0020, "bhA>h") \
+  SL_BT_CMD(nvm_save,                                    0x020d0020, "hA>") \
+  SL_BT_CMD(nvm_load,                                    0x030d0020, "h>A") \
+  SL_BT_CMD(nvm_erase,                                   0x040d0020, "h>") \
+  SL_BT_CMD(nvm_erase_all,                               0x010d0020, ">") \
+  SL_BT_CMD(test_dtm_tx,                                 0x000e0020, "bbbb>") \
+  SL_BT_CMD(test_dtm_rx,                                 0x010e0020, "bb>") \
+  SL_BT_CMD(test_dtm_end,                                0x020e0020, ">") \
+  SL_BT_CMD(sm_configure,                                0x010f0020, "bb>") \
+  SL_BT_CMD(sm_set_minimum_key_size,                     0x140f0020, "b>") \
+  SL_BT_CMD(sm_set_debug_mode,                           0x0f0f0020, ">") \
+  SL_BT_CMD(sm_add_to_whitelist,                         0x130f0020, "ab>") \
+  SL_BT_CMD(sm_store_bonding_configuration,              0x020f0020, "bb>") \
+  SL_BT_CMD(sm_set_bondable_mode,                        0x000f0020, "b>") \
+  SL_BT_CMD(sm_set_passkey,                              0x100f0020, "w>") \
+  SL_BT_CMD(sm_set_oob_data,                             0x0a0f0020, "A>") \
+  SL_BT_CMD(sm_use_sc_oob,                               0x110f0020, "b>A") \
+  SL_BT_CMD(sm_set_sc_remote_oob_data,                   0x120f0020, "A>") \
+  SL_BT_CMD(sm_increase_security,                        0x040f0020, "b>") \
+  SL_BT_CMD(sm_enter_passkey,                            0x080f0020, "bw>") \
+  SL_BT_CMD(sm_passkey_confirm,                          0x090f0020, "bb>") \
+  SL_BT_CMD(sm_bonding_confirm,                          0x0e0f0020, "bb>") \
+  SL_BT_CMD(sm_list_all_bondings,                        0x0b0f0020, ">") \
+  SL_BT_CMD(sm_delete_bonding,                           0x060f0020, "b>") \
+  SL_BT_CMD(sm_delete_bondings,                          0x070f0020, ">") \
+  SL_BT_CMD(ota_set_device_name,                         0x01100020, "A>") \
+  SL_BT_CMD(ota_set_advertising_data,                    0x02100020, "bA>") \
+  SL_BT_CMD(ota_set_configuration,                       0x03100020, "w>") \
+  SL_BT_CMD(ota_set_rf_path,                             0x04100020, "bb>") \
+  SL_BT_CMD(coex_set_options,                            0x00200020, "ww>") \
+  SL_BT_CMD(coex_set_parameters,                         0x02200020, "bbbb>") \
+  SL_BT_CMD(coex_set_directional_priority_pulse,         0x03200020, "b>") \
+  SL_BT_CMD(coex_get_counters,                           0x01200020, "b>A") \
+  SL_BT_CMD(l2cap_coc_send_connection_request,           0x01430020, "bhhhh>") \
+  SL_BT_CMD(l2cap_coc_send_connection_response,          0x02430020, "bhhhhh>") \
+  SL_BT_CMD(l2cap_coc_send_le_flow_control_credit,       0x03430020, "bhh>") \
+  SL_BT_CMD(l2cap_coc_send_disconnection_request,        0x04430020, "bh>") \
+  SL_BT_CMD(l2cap_coc_send_data,                         0x05430020, "bhA>") \
+  SL_BT_CMD(cte_transmitter_set_dtm_parameters,          0x04440020, "bbA>") \
+  SL_BT_CMD(cte_transmitter_clear_dtm_parameters,        0x05440020, ">") \
+  SL_BT_CMD(cte_transmitter_enable_connection_cte,       0x00440020, "bbA>") \
+  SL_BT_CMD(cte_transmitter_disable_connection_cte,      0x01440020, "b>") \
+  SL_BT_CMD(cte_transmitter_enable_connectionless_cte,   0x02440020, "bbbbA>") \
+  SL_BT_CMD(cte_transmitter_disable_connectionless_cte,  0x03440020, "b>") \
+  SL_BT_CMD(cte_transmitter_enable_silabs_cte,           0x06440020, "bbbbA>") \
+  SL_BT_CMD(cte_transmitter_disable_silabs_cte,          0x07440020, "b>") \
+  SL_BT_CMD(cte_receiver_set_dtm_parameters,             0x05450020, "bbbA>") \
+  SL_BT_CMD(cte_receiver_clear_dtm_parameters,           0x06450020, ">") \
+  SL_BT_CMD(cte_receiver_set_sync_cte_type,              0x09450020, "b>") \
+  SL_BT_CMD(cte_receiver_configure,                      0x00450020, "b>") \
+  SL_BT_CMD(cte_receiver_enable_connection_cte,          0x01450020, "bhbbbA>") \
+  SL_BT_CMD(cte_receiver_disable_connection_cte,         0x02450020, "b>") \
+  SL_BT_CMD(cte_receiver_enable_connectionless_cte,      0x03450020, "hbbA>") \
+  SL_BT_CMD(cte_receiver_disable_connectionless_cte,     0x04450020, "h>") \
+  SL_BT_CMD(cte_receiver_enable_silabs_cte,              0x07450020, "bbA>") \
+  SL_BT_CMD(cte_receiver_disable_silabs_cte,             0x08450020, ">") \
+  SL_BT_CMD(user_message_to_target,                      0x00ff0020, "A>A")
+
+#endif
@@ -0,0 +1,50 @@
+/***************************************************************************//**
+ * @brief Binary trace of SL_BT_API traffic for the NCP host
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "sl_bt_ncp_trace.h"
+
+#if SL_BT_TRACE_LEN
+sl_bt_trace_rec_t sl_bt_trace_ring[SL_BT_TRACE_LEN];
+uint32_t sl_bt_trace_count;
+static uint32_t sl_bt_trace_freq;
+
+static void out_u32(void (*out)(char), uint32_t value)
+{
+  out((char)value);
+  out((char)(value >> 8));
+  out((char)(value >> 16));
+  out((char)(value >> 24));
+}
+#endif
+
+void sl_bt_trace_init(uint32_t freq)
+{
+#if SL_BT_TRACE_LEN
+  DEMCR |= DEMCR_TRCENA;             // turn on the DWT unit
+  DWTCYCCNT = 0;
+  DWTCTRL |= DWTCTRL_CYCCNTENA;      // start counting CPU cycles
+  sl_bt_trace_freq = freq;
+  sl_bt_trace_count = 0;
+#endif
+}
+
+void sl_bt_trace_dump(void (*out)(char))
+{
+#if SL_BT_TRACE_LEN
+  uint32_t end = sl_bt_trace_count;  // records added during the dump are left for next time
+  uint32_t start = end > SL_BT_TRACE_LEN ? end - SL_BT_TRACE_LEN : 0;
+  uint32_t i;
+  out('B'); out('G'); out('T'); out('R');
+  out_u32(out, 1);
+  out_u32(out, sl_bt_trace_freq);
+  out_u32(out, end - start);
+  for (i = start; i != end; i++) {
+    out_u32(out, sl_bt_trace_ring[i & (SL_BT_TRACE_LEN - 1)].cycles);
+    out_u32(out, sl_bt_trace_ring[i & (SL_BT_TRACE_LEN - 1)].header);
+  }
+#else
+  (void)out;
+#endif
+}
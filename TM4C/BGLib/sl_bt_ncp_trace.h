@@ -0,0 +1,72 @@
+/***************************************************************************//**
+ * @brief Binary trace of SL_BT_API traffic for the NCP host
+ ******************************************************************************/
+
+#ifndef SL_BT_NCP_TRACE_H
+#define SL_BT_NCP_TRACE_H
+
+#include <stdint.h>
+#include "../../inc/CortexM.h"
+
+/*****************************************************************************
+ *
+ *  Every command sent and every response or event header received is
+ *  stored as two words in a RAM ring: the DWT cycle counter and the BGAPI
+ *  header. Recording costs a handful of cycles and never blocks; when the
+ *  ring is full the oldest records are overwritten.
+ *
+ *  The header is stored as received, except commands sent by the host
+ *  have SL_BT_TRACE_TX (bit 6 of the device type field, always 0 for
+ *  Bluetooth messages) set so they can be told apart from responses.
+ *
+ *  sl_bt_trace_dump() writes the ring as:
+ *      "BGTR"  magic
+ *      u32     format version (1)
+ *      u32     cycle counter frequency in Hz
+ *      u32     number of records that follow
+ *      records, oldest first: u32 cycles, u32 header
+ *  all little endian. tools/bgtrace_decode.py turns a dump into per-command
+ *  latency histograms and event-rate timelines.
+ *
+ *  Define SL_BT_TRACE_LEN=0 to compile the trace out.
+ *
+ ****************************************************************************/
+
+#ifndef SL_BT_TRACE_LEN
+#define SL_BT_TRACE_LEN 256          // records, must be a power of 2
+#endif
+
+#define SL_BT_TRACE_TX  0x00000040   // header flag for host to NCP commands
+
+#if SL_BT_TRACE_LEN
+typedef struct {
+  uint32_t cycles;
+  uint32_t header;
+} sl_bt_trace_rec_t;
+
+extern sl_bt_trace_rec_t sl_bt_trace_ring[SL_BT_TRACE_LEN];
+extern uint32_t sl_bt_trace_count;   // records ever written
+
+#define SL_BT_TRACE(HEADER) do {                                       \
+    sl_bt_trace_rec_t *r = &sl_bt_trace_ring[sl_bt_trace_count & (SL_BT_TRACE_LEN - 1)]; \
+    r->cycles = DWTCYCCNT;                                              \
+    r->header = (HEADER);                                              \
+    sl_bt_trace_count++;                                               \
+} while (0)
+#else
+#define SL_BT_TRACE(HEADER)
+#endif
+
+/**
+ * Start the DWT cycle counter and empty the ring
+ * @param freq cycle counter (CPU clock) frequency in Hz, stored in dumps
+ */
+void sl_bt_trace_init(uint32_t freq);
+
+/**
+ * Write the ring, oldest record first, in the dump format above
+ * @param out function that sends one byte, e.g. UART_OutChar for UART0
+ */
+void sl_bt_trace_dump(void (*out)(char));
+
+#endif
@@ -12,16 +12,36 @@ BLE handler
 #include "BLEHandler.h"
 #include "../inc/user.h"
 #include "../inc/UART1int.h"
+#include "../inc/UART0int.h"
 #include "../inc/tm4c123gh6pm.h"
 #include "./BGLib/sl_bt_api.h"
 #include "./BGLib/sl_bt_ncp_host.h"
-#include "../inc/ST7735.h"
+#include "./BGLib/sl_bt_ncp_trace.h"
+#include "Display.h"
+#include "Dashboard.h"
+#include "Log.h"
+#include "../inc/Clock.h"
+#include "../inc/CortexM.h"
+#include "../inc/FIFO.h"
+#include "../inc/Probe.h"
 
 #define gattdb_device_name 11
 #define gattdb_fake_device_name 31
 #define gattdb_data_ready 27
 #define gattdb_contact_user 21
 
+// UART link to the NCP. The NCP boots at 115200 baud; after boot we ask it
+// to move to BLE_FAST_BAUD (0 keeps 115200). RTS/CTS to the NCP are wired
+// to PF0/PF1 and on, as UART1_Init leaves them; BLE_FLOW_CONTROL 0 turns
+// them off for an NCP board without the lines. BLE_RX_LEVEL is the
+// hardware RX FIFO interrupt level; the receive time-out delivers frame
+// tails, so a BGAPI header (4 bytes) arrives with one interrupt at 1/4.
+#define BLE_FAST_BAUD 0
+#define BLE_FLOW_CONTROL 1
+#define BLE_RX_LEVEL UART_IFLS_RX2_8
+#define USER_MSG_SET_BAUD 0x01
+#define BAUD_SWITCH_DELAY_MS 5
+
 
 SL_BT_API_DEFINE();
 static void sl_bt_on_event(sl_bt_msg_t* evt);
@@ -29,33 +49,37 @@ static void uart_tx_wrapper(uint32_t len, uint8_t* data);
 static int32_t uartRx(uint32_t len, uint8_t* data);
 static int32_t uartRxPeek(void);
 
-static struct sl_bt_evt_scanner_scan_report_s report;
 static const int8_t MIN_RSSI = -60;
 
 #define CONTACT_LIST_SIZE 256
 profile_t Contacts[CONTACT_LIST_SIZE];
 uint16_t CurContactIdx;
-
-static char message[100];
+static uint32_t OpenConnections;
 
 void BLEHandler_Init(void) {
-	SL_BT_API_INITIALIZE(uart_tx_wrapper, uartRx);
+	SL_BT_API_INITIALIZE_NONBLOCK(uart_tx_wrapper, uartRx, uartRxPeek);
+	SL_BT_API_INITIALIZE_ZEROCOPY(UART1_RxView, UART1_RxCommit); // parse frames in the RX ring
+	sl_bt_trace_init(Clock_GetFreq());
 	UART1_Init();
-	ST7735_OutString("EE445L Final\nInitializing BLE...");
+	UART1_FlowControl(BLE_FLOW_CONTROL);
+	UART1_SetRxLevel(BLE_RX_LEVEL);
+	Display_PostMsg(DISPLAY_MSG_INIT);
 	CurContactIdx = 0;
 	
 	sl_bt_system_reset(0);
 }
 
-void BLEHandler_Main_Loop(void){
+int BLEHandler_Main_Loop(void){
 	sl_bt_msg_t evt;
 	
 	sl_status_t status = sl_bt_pop_event(&evt);
-	if(status != SL_STATUS_OK) return;
+	if(status != SL_STATUS_OK) return 0;
 	sl_bt_on_event(&evt);
+	return 1;
 }
 
 static void addContact(profile_t newContact) {
+	if(CurContactIdx >= CONTACT_LIST_SIZE) return; // full until sendContacts
 	strcpy(Contacts[CurContactIdx++].profile, newContact.profile);
 	
 	/* Keep for now: may want to divide up contact info more in future iteration */
@@ -109,6 +133,34 @@ void BLESwitch_Advertisement() {
 //}
 
 
+//****************************************//
+//        Baud Rate Negotiation           //
+//****************************************//
+// Request to the NCP target application: {USER_MSG_SET_BAUD, baud (little
+// endian, 4 bytes)}. The target answers with SL_STATUS_OK at the old rate and
+// then reconfigures its own UART, so we switch once the response is in.
+int BLEHandler_SetBaud(uint32_t baud){
+	sl_status_t sc;
+	uint8_t request[5];
+	uint8_t response[4];
+	size_t response_len;
+	request[0] = USER_MSG_SET_BAUD;
+	request[1] = baud & 0xff;
+	request[2] = (baud >> 8) & 0xff;
+	request[3] = (baud >> 16) & 0xff;
+	request[4] = (baud >> 24) & 0xff;
+	sc = sl_bt_user_message_to_target(sizeof(request), request, sizeof(response), &response_len, response);
+	if(sc != SL_STATUS_OK){
+		return 0; // target does not support it, stay at the current rate
+	}
+	Clock_Delay1ms(BAUD_SWITCH_DELAY_MS); // let the target finish switching
+	if(!UART1_SetBaud(baud)){
+		return 0;
+	}
+	// blocks until the target answers at the new rate
+	return sl_bt_system_hello() == SL_STATUS_OK;
+}
+
 //****************************************//
 //        Helper Functions                //
 //****************************************//
@@ -134,7 +186,7 @@ user_profile_t dummy_profile[10] = {
 
 
 static bool existingContact(char* name){
-	for(int i = 0; i < CONTACT_LIST_SIZE; i++){
+	for(int i = 0; i < CurContactIdx; i++){
 		if(strcmp(name, Contacts[i].profile) == 0){
 			return true;
 		}
@@ -144,19 +196,19 @@ static bool existingContact(char* name){
 
 static bool validBLE(struct sl_bt_evt_scanner_scan_report_s* report){
 	if(report->rssi < MIN_RSSI){ return false; }
-	uint8array data = report->data;
-	if(data.len < 18){ return false; }
-	return data.data[3] == 0x05 
-			&& data.data[4] == 0xFF 
-			&& data.data[5] == 0xFF 
-			&& data.data[6] == 0x02 
-			&& data.data[7] == 0x00 
-			&& data.data[8] == 0xFF;
+	const uint8array *data = &report->data; // the bytes follow len in place
+	if(data->len < 18){ return false; }
+	return data->data[3] == 0x05 
+			&& data->data[4] == 0xFF 
+			&& data->data[5] == 0xFF 
+			&& data->data[6] == 0x02 
+			&& data->data[7] == 0x00 
+			&& data->data[8] == 0xFF;
 }
 
-static void parseData(uint8array data, profile_t* profile){
-	char name[7];
-	sprintf(name, "%c%c%c%c%c%c%d", (char)data.data[11], (char)data.data[12], (char)data.data[13], (char)data.data[14], (char)data.data[15], (char)data.data[16], data.data[17]);
+static void parseData(const uint8array *data, profile_t* profile){
+	char name[10];
+	sprintf(name, "%c%c%c%c%c%c%d", (char)data->data[11], (char)data->data[12], (char)data->data[13], (char)data->data[14], (char)data->data[15], (char)data->data[16], data->data[17]);
 	strcpy(profile->profile, name);
 	//profile.profile = "";
 	//profile_t profile;
@@ -185,33 +237,40 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 	
 	switch(SL_BT_MSG_ID(evt->header)){
 		case sl_bt_evt_system_boot_id:{
-			ST7735_OutString("Connection Success");
-			sprintf(message, "Bluttooth Stack \nBooted:\n v%d.%d.%d-b%d\n", evt->data.evt_system_boot.major, evt->data.evt_system_boot.minor, 
-																											evt->data.evt_system_boot.patch, evt->data.evt_system_boot.build);
-			ST7735_OutString(message);
+			uint16_t args[DISPLAY_MAXARGS];
+			args[0] = evt->data.evt_system_boot.major;
+			args[1] = evt->data.evt_system_boot.minor;
+			args[2] = evt->data.evt_system_boot.patch;
+			args[3] = evt->data.evt_system_boot.build;
+			Display_Post(DISPLAY_MSG_BOOT, args, 4);
 			sc = sl_bt_system_hello();
 			if(sc != SL_STATUS_OK){
-				ST7735_OutString("Connection Failed");
+				Display_PostMsg(DISPLAY_MSG_HELLO_FAILED);
+			}
+			if(BLE_FAST_BAUD && !BLEHandler_SetBaud(BLE_FAST_BAUD)){
+				Display_PostMsg(DISPLAY_MSG_BAUD_FAILED);
 			}
 			sc = sl_bt_system_get_identity_address(&address, &address_type);
 			if(sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to get address");
+				Display_PostMsg(DISPLAY_MSG_ADDR_FAILED);
 				break;
 			}
-			sprintf(message, "%s Address:\n %02X:%02X:%02X:%02X:%02X:%02X\n", address_type? "static random": "public device", address.addr[5], address.addr[4], address.addr[3], address.addr[2], address.addr[1], address.addr[0]);
-			ST7735_OutString(message);
+			for(int i = 0; i < 6; i++){
+				args[i] = address.addr[5 - i];
+			}
+			Display_Post(address_type? DISPLAY_MSG_ADDR_STATIC: DISPLAY_MSG_ADDR_PUBLIC, args, 6);
 			
 
 			uint8_t device_name[] = {0x44, 0x65, 0x76, 0x69, 0x63, 0x65};
 			sc = sl_bt_gatt_server_write_attribute_value(gattdb_device_name, 0, 6 , device_name);
 			if(sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to set attribute\n");
+				Display_PostMsg(DISPLAY_MSG_ATTR_FAILED);
 			}
 				
 			// Create an advertising set.
       sc = sl_bt_advertiser_create_set(&advertising_set_handle);
 			if (sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to create advertising set\n");
+				Display_PostMsg(DISPLAY_MSG_ADV_SET_FAILED);
 				break;
 			}
 			
@@ -219,7 +278,7 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 		 // Set advertising data
 			sc = sl_bt_advertiser_set_data(advertising_set_handle, 0, adv_data_len, adv_data);
 			if (sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to set advertising data\n");
+				Display_PostMsg(DISPLAY_MSG_ADV_DATA_FAILED);
 				break;
 			}
 			
@@ -231,7 +290,7 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
         0,   // adv. duration
         0);  // max. num. adv. events
 			if (sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to set \nadvertising timing\n");
+				Display_PostMsg(DISPLAY_MSG_ADV_TIMING_FAILED);
 				break;
 			}
 				
@@ -241,34 +300,37 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
         advertiser_user_data,
         advertiser_connectable_scannable);
 			if (sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to start advertising\n");
+				Display_PostMsg(DISPLAY_MSG_ADV_START_FAILED);
 				break;
 			}
 				
 //			// Start scanning
 //			sc = sl_bt_scanner_start(1, 1);
 //			if(sc != SL_STATUS_OK){
-//				ST7735_OutString("Failed to start scanning\n");
+//				Display_PostMsg(DISPLAY_MSG_SCAN_FAILED);
 //			}
-			ST7735_OutString("BLE Successfully inisialized...\n");
-			for(int i = 0; i < 99999999; i++);
-			ST7735_FillScreen(ST7735_BLACK);	
+			Display_PostMsg(DISPLAY_MSG_BLE_READY);
+			Display_SetView(DISPLAY_VIEW_DASHBOARD);
 			break;
 		}
 		case sl_bt_evt_connection_opened_id:{
-			ST7735_OutString("New Connection Opened\n");
+			Display_PostMsg(DISPLAY_MSG_CONN_OPENED);
+			Dashboard_SetActive(++OpenConnections);
 			profile_index = 0;
 			break;
 		}
 		case sl_bt_evt_connection_closed_id:{
-			ST7735_OutString("Connection Closed\n");
+			Display_PostMsg(DISPLAY_MSG_CONN_CLOSED);
+			if(OpenConnections){
+				Dashboard_SetActive(--OpenConnections);
+			}
       // Start general advertising and enable connections.
       sc = sl_bt_advertiser_start(
         advertising_set_handle,
         advertiser_user_data,
         advertiser_connectable_scannable);
 			if (sc != SL_STATUS_OK){
-				ST7735_OutString("Failed to start advertising\n");
+				Display_PostMsg(DISPLAY_MSG_ADV_START_FAILED);
 				break;
 			}
 			break;
@@ -277,24 +339,24 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 		case sl_bt_evt_gatt_server_attribute_value_id:{
 			switch (evt->data.evt_gatt_server_attribute_value.attribute){
 				case gattdb_fake_device_name: {
-					ST7735_OutString("Device Name Changed\n");
+					Display_PostMsg(DISPLAY_MSG_NAME_CHANGED);
 					size_t value_len;
 					const size_t max_length = 15;
 					uint8_t value[16];
 					sc = sl_bt_gatt_server_read_attribute_value(gattdb_fake_device_name, 0, max_length, &value_len, value);
 					if(sc != SL_STATUS_OK){
-						ST7735_OutString("Failed to get device name\n");
+						Display_PostMsg(DISPLAY_MSG_NAME_FAILED);
 					}	
 					sc = sl_bt_gatt_server_write_attribute_value(gattdb_device_name, 0, value_len , value);
 					if(sc != SL_STATUS_OK){
-						ST7735_OutString("Failed to set attribute\n");
+						Display_PostMsg(DISPLAY_MSG_ATTR_FAILED);
 					}
 					adv_data_len = 11 + value_len;
 					adv_data[9] = value_len + 1;
 					memcpy(adv_data + 11, value, value_len);					
 					sc = sl_bt_advertiser_set_data(advertising_set_handle, 0, adv_data_len, adv_data);
 					if (sc != SL_STATUS_OK){
-						ST7735_OutString("Failed to set advertising data\n");
+						Display_PostMsg(DISPLAY_MSG_ADV_DATA_FAILED);
 						break;
 					}				
 					break;
@@ -308,7 +370,7 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 					memcpy(user_profile + 10, dummy_profile[profile_index].time, 2);
 					sc = sl_bt_gatt_server_write_attribute_value(gattdb_contact_user, 0, 12, user_profile);
 					if(sc != SL_STATUS_OK){
-						ST7735_OutString("Fail to write user profile\n");	
+						Display_PostMsg(DISPLAY_MSG_PROFILE_FAILED);	
 					}
 					if(profile_index == 10){
 						return;
@@ -316,7 +378,7 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 					profile_index ++;
 					sc = sl_bt_gatt_server_send_characteristic_notification(0xff, gattdb_data_ready, 1, &ready, &sent_len);
 					if(sc != SL_STATUS_OK){
-						ST7735_OutString("Fail to write user profile\n");	
+						Display_PostMsg(DISPLAY_MSG_PROFILE_FAILED);	
 					}
 				}
 				default:
@@ -326,11 +388,15 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 		}
 		
 		case sl_bt_evt_scanner_scan_report_id:{
-			report = evt->data.evt_scanner_scan_report;
-			if (validBLE(&report)){
+			struct sl_bt_evt_scanner_scan_report_s *report = &evt->data.evt_scanner_scan_report;
+			if (validBLE(report)){
 				profile_t profile;
-				parseData(report.data, &profile);
-				addContact(profile);
+				parseData(&report->data, &profile);
+				bool isNew = !existingContact(profile.profile);
+				if(isNew){
+					addContact(profile);
+				}
+				Dashboard_Contact(report->rssi, isNew);
 			}
 			break;
 		}
@@ -342,31 +408,74 @@ static void sl_bt_on_event(sl_bt_msg_t* evt){
 
 
 
+//****************************************//
+//        Trace Dump (UART0)              //
+//****************************************//
+// UART0 (PA1) 115200 baud through UART0int.c, whose TX interrupt drains
+// its software FIFO. Only used for trace and stats dumps, so it is set up
+// the first time a dump is requested.
+static void traceUartInit(void){
+	static uint8_t uart0Ready = 0;
+	if(!uart0Ready){
+		UART_Init();
+		uart0Ready = 1;
+	}
+}
+
+void BLEHandler_TraceDump(void){
+	traceUartInit();
+	sl_bt_trace_dump(&UART_OutChar);
+	Log_Dump(&UART_OutChar);
+}
+
+void BLEHandler_StatsDump(void){
+	uint32_t stats[4];
+	char line[64];
+	traceUartInit();
+	FifoStats_Print(&UART_OutChar);       // empty unless built with FIFO_STATS 1
+	UART1_GetRxStats(&stats[0], &stats[1], &stats[2], &stats[3]);
+	sprintf(line, "uart1 rx ints %u timeouts %u bytes %u late %u\r\n",
+	        (unsigned)stats[0], (unsigned)stats[1], (unsigned)stats[2], (unsigned)stats[3]);
+	UART_OutString(line);
+	Probe_Print(&UART_OutChar, Clock_GetFreq()); // empty unless built with PROBE_ENABLE 1
+}
+
 //****************************************//
 //        UART_TX_WRAPPER                 //
 //****************************************//
 static void uart_tx_wrapper(uint32_t len, uint8_t* data){
-	for(int i = 0; i < len; i++){
-		UART1_OutChar(data[i]);
-	}
+	UART1_Write(data, len);
 }
 
 //****************************************//
 //        UART_RX                         //
 //****************************************//
 static int32_t uartRx(uint32_t len, uint8_t* data){
-		int32_t total = 0;
-		for(int i = 0; i < len; i++){
-			data[i] = UART1_InChar();
-			total++;
-		}
-		return total;
+		return (int32_t)UART1_Read(data, len);
 }
 //****************************************//
 //        UART_RX_PEEK                    //
 //****************************************//
+// Reports 0 until a whole BGAPI frame is in the receive ring, so
+// pop_event returns instead of spinning in the parser while the rest of
+// a long event arrives; the next RX interrupt signals SCHED_BLE again.
+// A byte that cannot start a frame is reported at once for the parser
+// to skip.
 static int32_t uartRxPeek(void){
-	return (int32_t)UART1_InStatus();
+	const uint8_t *pt1, *pt2;
+	uint32_t len1, len2, avail, i, length;
+	uint32_t header = 0;
+	avail = UART1_RxView(&pt1, &len1, &pt2, &len2);
+	if(avail == 0){ return 0; }
+	if((pt1[0]&0x78) != sl_bt_dev_type_default){ return (int32_t)avail; }
+	if(avail < SL_BT_MSG_HEADER_LEN){ return 0; }
+	for(i = 0; i < SL_BT_MSG_HEADER_LEN; i++){ // little endian, as the parser reads it
+		header |= (uint32_t)((i < len1)? pt1[i]: pt2[i - len1]) << (8*i);
+	}
+	length = SL_BT_MSG_LEN(header);
+	if(length > SL_BT_MAX_PAYLOAD_SIZE){ return (int32_t)avail; }
+	if(avail < SL_BT_MSG_HEADER_LEN + length){ return 0; }
+	return (int32_t)avail;
 }
 
 
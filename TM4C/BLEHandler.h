@@ -15,8 +15,24 @@ bluetooth chip using UART1.
 /** Initializes UART1. */
 void BLEHandler_Init(void);
 
-/** Main Event Loop */
-void BLEHandler_Main_Loop(void);
+/** Main Event Loop: handle one pending BLE event.
+Returns 1 if an event was handled, 0 if none was waiting. */
+int BLEHandler_Main_Loop(void);
+
+/** Send the BGAPI traffic trace and then the message log (Log.h) out
+UART0 (PA1, 115200 baud), for tools/bgtrace_decode.py and
+tools/log_decode.py.  main runs it when switch 2 is pressed. */
+void BLEHandler_TraceDump(void);
+
+/** Print FIFO occupancy (FIFO_STATS builds), UART1 receive interrupt
+counts and latency histograms (PROBE_ENABLE builds) as text out UART0
+(PA1, 115200 baud).  Interrupts keep running while it prints.  main
+runs it when switch 1 is pressed. */
+void BLEHandler_StatsDump(void);
+
+/** Ask the NCP to switch to the given baud rate, then follow it.
+Returns 1 on success, 0 if the NCP refused (the old rate is kept). */
+int BLEHandler_SetBaud(uint32_t baud);
 
 // Receiving data ====================================================
 
@@ -0,0 +1,252 @@
+/* =======================Dashboard.c================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Contact dashboard
+
+Drawn through the panel's DisplayDev_t.  Text rows 0-2 hold the numbers;
+the plot below them, to the bottom of the panel, holds one bar per hour,
+each bar one fill (4 pixels wide on the ST7735, as wide as fits on
+others).  Every field has a dirty flag and remembers what it last drew,
+so a setter that does not change what is shown costs nothing, and many
+changes between two Dashboard_Update calls cost one redraw.  A bar that
+grows is one fill; a bar that shrinks (new hour, new day) also erases
+the rows it left.  The plot is cleared only when the bars outgrow the
+scale.
+===================================================================== */
+
+#include <stdint.h>
+#include "Dashboard.h"
+#include "../inc/DisplayDev.h"
+
+#define DASH_HOURS    24
+#define DASH_COLS     21     // text columns used
+#define DASH_BARX     4      // x of the bar for hour 0, also the right margin
+#define DASH_MINPLOT  16     // pixel rows the plot needs at least
+#define DASH_MINSCALE 8      // contacts per hour at the top of the plot
+#define DASH_COLOR    0x07E0 // ST7735_GREEN
+#define DASH_BLACK    0
+#define DASH_BARCOLOR 0      // black
+#define DASH_PLOTBG   0xE73C // ST7735_Color565(228,228,228), as ST7735_PlotClear
+
+// dirty flags
+#define DIRTY_ALL     0x01   // labels and plot background
+#define DIRTY_TODAY   0x02
+#define DIRTY_ACTIVE  0x04
+#define DIRTY_RSSI    0x08
+#define DIRTY_SCALE   0x10
+#define DIRTY_VALUES  (DIRTY_TODAY|DIRTY_ACTIVE|DIRTY_RSSI|DIRTY_SCALE)
+
+static const DisplayDev_t *Dev;
+static uint32_t PlotTop;               // first pixel row of the plot
+static uint32_t PlotH;                 // pixel rows from PlotTop to the bottom
+static uint32_t BarW;                  // bar width, one pixel gap between bars
+
+static uint32_t Dirty;
+static uint32_t HourDirty;             // bit h: the bar of hour h changed
+
+static uint32_t Today;                 // contacts since midnight
+static uint32_t Active;
+static int32_t Rssi;                   // shown: max of the two windows
+static int32_t RssiNow, RssiPrev;      // strongest this and last minute
+static uint16_t Hourly[DASH_HOURS];
+static uint16_t Drawn[DASH_HOURS];     // bar height on the panel
+static uint32_t Scale;
+static uint32_t Hour, Minute;
+
+static void updateRssi(void) {
+	int32_t shown = (RssiNow > RssiPrev)? RssiNow: RssiPrev;
+	if (shown != Rssi) {
+		Rssi = shown;
+		Dirty |= DIRTY_RSSI;
+	}
+}
+
+static void setHour(uint32_t h, uint16_t count) {
+	if (Hourly[h] != count) {
+		Hourly[h] = count;
+		HourDirty |= 1u << h;
+	}
+	while (count > Scale) {              // rescale, every bar redraws
+		Scale = 2*Scale;
+		Dirty |= DIRTY_SCALE;
+	}
+}
+
+// smallest scale, from DASH_MINSCALE up, that fits every bar still shown
+static void fitScale(void) {
+	uint32_t h, scale = DASH_MINSCALE;
+	for (h = 0; h < DASH_HOURS; h++) {
+		while (Hourly[h] > scale) {
+			scale = 2*scale;
+		}
+	}
+	if (scale != Scale) {
+		Scale = scale;
+		Dirty |= DIRTY_SCALE;
+	}
+}
+
+int Dashboard_Init(const DisplayDev_t *dev) {
+	uint32_t h;
+	Dev = dev;
+	PlotTop = 3*dev->charH + 2;
+	PlotH = dev->height - PlotTop;
+	BarW = (dev->width - 2*DASH_BARX)/DASH_HOURS - 1;
+	Today = 0;
+	Active = 0;
+	RssiNow = RssiPrev = Rssi = DASHBOARD_NORSSI;
+	for (h = 0; h < DASH_HOURS; h++) {
+		Hourly[h] = 0;
+	}
+	Scale = DASH_MINSCALE;
+	Hour = Minute = 0;
+	Dashboard_Invalidate();
+	return !(dev->flags & DISPLAYDEV_TEXTONLY) && (DisplayDev_Cols(dev) >= DASH_COLS) &&
+		(dev->height >= PlotTop + DASH_MINPLOT) && (dev->width >= 2*DASH_BARX + 2*DASH_HOURS);
+}
+
+void Dashboard_Contact(int8_t rssi, int isNew) {
+	if (rssi > RssiNow) {
+		RssiNow = rssi;
+		updateRssi();
+	}
+	if (isNew) {
+		Today++;
+		Dirty |= DIRTY_TODAY;
+		setHour(Hour, Hourly[Hour] + 1);
+	}
+}
+
+void Dashboard_SetActive(uint32_t count) {
+	if (count != Active) {
+		Active = count;
+		Dirty |= DIRTY_ACTIVE;
+	}
+}
+
+void Dashboard_SetTime(uint32_t hhmm) {
+	uint32_t hour = (hhmm / 100) % DASH_HOURS;
+	uint32_t minute = hhmm % 100;
+	if (minute != Minute) {
+		Minute = minute;
+		RssiPrev = RssiNow;
+		RssiNow = DASHBOARD_NORSSI;
+		updateRssi();
+	}
+	if (Hour != hour) {
+		do {                               // start each hour passed at 0
+			Hour = (Hour + 1) % DASH_HOURS;
+			if (Hour == 0 && Today) {
+				Today = 0;
+				Dirty |= DIRTY_TODAY;
+			}
+			setHour(Hour, 0);
+		} while (Hour != hour);
+		fitScale();                        // shrink once the tall bars are gone
+	}
+}
+
+void Dashboard_Invalidate(void) {
+	Dirty = DIRTY_ALL;
+}
+
+// right-aligned decimal in a field of width characters on text row row
+static void drawNumber(uint32_t col, uint32_t row, uint32_t width, int32_t value) {
+	char buf[12];
+	char *pt = &buf[11];
+	uint32_t n = (value < 0)? -(uint32_t)value: (uint32_t)value;
+	*pt = 0;
+	do {
+		*--pt = '0' + n % 10;
+		n = n / 10;
+	} while (n);
+	if (value < 0) {
+		*--pt = '-';
+	}
+	while (pt > &buf[11 - width]) {
+		*--pt = ' ';
+	}
+	Dev->text(col, row, pt, DASH_COLOR);
+}
+
+// first pixel row of a bar of count contacts; the bottom row stays clear
+// and a full-scale bar reaches PlotTop, as ST7735_PlotBar
+static uint32_t barTop(uint32_t count) {
+	return PlotTop + ((PlotH - 1)*(Scale - count))/Scale;
+}
+
+static void drawBar(uint32_t h) {
+	uint32_t x = DASH_BARX + h*(BarW + 1);
+	uint32_t top = barTop(Hourly[h]);
+	uint32_t bottom = PlotTop + PlotH - 1;
+	if (Hourly[h] < Drawn[h]) {          // erase down to the new top
+		Dev->fill(x, PlotTop, BarW, top - PlotTop, DASH_PLOTBG);
+	}
+	if (Hourly[h]) {
+		Dev->fill(x, top, BarW, bottom - top, DASH_BARCOLOR);
+	}
+	Drawn[h] = Hourly[h];
+}
+
+// clear the plot at the current scale; every nonzero bar has to be redrawn
+static void clearPlot(void) {
+	uint32_t h;
+	Dev->fill(0, PlotTop, Dev->width, PlotH, DASH_PLOTBG);
+	for (h = 0; h < DASH_HOURS; h++) {
+		Drawn[h] = 0;
+		if (Hourly[h]) {
+			HourDirty |= 1u << h;
+		}
+	}
+}
+
+int Dashboard_Update(void) {
+	uint32_t h;
+	if (Dirty & DIRTY_ALL) {
+		Dev->fill(0, 0, Dev->width, PlotTop, DASH_BLACK);
+		Dev->text(0, 0, "Contacts today", DASH_COLOR);
+		Dev->text(0, 1, "Active", DASH_COLOR);
+		Dev->text(11, 1, "RSSI", DASH_COLOR);
+		Dev->text(0, 2, "Per hour, max", DASH_COLOR);
+		drawNumber(16, 2, 5, Scale);
+		clearPlot();
+		Dirty = DIRTY_VALUES & ~DIRTY_SCALE;
+		return 1;
+	}
+	if (Dirty & DIRTY_SCALE) {
+		Dirty &= ~DIRTY_SCALE;
+		drawNumber(16, 2, 5, Scale);
+		clearPlot();
+		return 1;
+	}
+	if (Dirty & DIRTY_TODAY) {
+		Dirty &= ~DIRTY_TODAY;
+		drawNumber(16, 0, 5, Today);
+		return 1;
+	}
+	if (Dirty & DIRTY_ACTIVE) {
+		Dirty &= ~DIRTY_ACTIVE;
+		drawNumber(7, 1, 3, Active);
+		return 1;
+	}
+	if (Dirty & DIRTY_RSSI) {
+		Dirty &= ~DIRTY_RSSI;
+		if (Rssi == DASHBOARD_NORSSI) {
+			Dev->text(16, 1, "   --", DASH_COLOR);
+		} else {
+			drawNumber(16, 1, 5, Rssi);
+		}
+		return 1;
+	}
+	for (h = 0; HourDirty; h++) {
+		if (HourDirty & (1u << h)) {
+			HourDirty &= ~(1u << h);
+			if (Hourly[h] != Drawn[h]) {   // may have changed back
+				drawBar(h);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
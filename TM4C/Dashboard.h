@@ -0,0 +1,45 @@
+/* =======================Dashboard.h================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Live contact dashboard: contacts today, active encounters,
+the strongest nearby RSSI and a per-hour bar graph.  The setters only
+record values and mark what changed; Dashboard_Update draws the changed
+regions when the display is idle.  Display.c decides when the dashboard
+owns the panel (Display_SetView).
+===================================================================== */
+
+#ifndef DASHBOARD_H
+#define DASHBOARD_H
+
+#include <stdint.h>
+#include "../inc/DisplayDev.h"
+
+#define DASHBOARD_NORSSI (-128) // no peer heard in the last minute
+
+/** Clear the counters and mark everything for drawing on dev.  Returns 1
+ *  if the panel can show the dashboard (pixels, 21 text columns, room
+ *  for the plot), 0 if not. */
+int Dashboard_Init(const DisplayDev_t *dev);
+
+/** A peer was heard at the given RSSI (dBm); isNew is nonzero the first
+ *  time it is heard today, which counts it as a contact. */
+void Dashboard_Contact(int8_t rssi, int isNew);
+
+/** Number of encounters (open connections) in progress. */
+void Dashboard_SetActive(uint32_t count);
+
+/** Time of day as hours*100 + minutes.  A new hour starts its bar from 0,
+ *  midnight clears the day; the RSSI shown is the strongest over the
+ *  current and previous minute. */
+void Dashboard_SetTime(uint32_t hhmm);
+
+/** Mark the whole dashboard for drawing, e.g. after another view used the
+ *  panel. */
+void Dashboard_Invalidate(void);
+
+/** Draw one changed region.  Returns 1 if something was drawn, 0 if the
+ *  panel is up to date. */
+int Dashboard_Update(void);
+
+#endif // DASHBOARD_H
@@ -1,43 +1,299 @@
 /* =======================Display.c===================================
 Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
-EE445L Fall 2020 for McDermott, Mark 
+EE445L Fall 2020 for McDermott, Mark
 
 Display interface
+
+Everything is drawn through the DisplayDev_t given to Display_Init
+(inc/DisplayDev.h), so the same code runs on any of the panel drivers.
+The log is a scrolling console.  Row 0 holds the title and stays put
+(unless the panel has a single row); the rows below are the hardware
+scrolling area on panels that have one.  There a new line clears and
+draws the one text row that is leaving the top, then moves the scroll
+start address by one row, instead of redrawing the whole panel; other
+panels redraw the log rows.  Lines are cut at DISPLAY_COLS characters or
+the panel width.  The last DISPLAY_SCROLLBACK lines are kept in RAM for
+Display_ScrollBack.
+
+Event handlers do not draw.  Display_Post puts a record (message ID and
+up to six 16-bit arguments) in the binary log (Log.h) and returns;
+Display_Render, called from the main loop when there is nothing else to
+do, takes the next record from the log, formats it with its entry in
+Formats and shows it.  Records the log overwrote before they were shown
+are counted, so the panel never holds up BLE event handling.  The same
+records stay in the log for a dump, and tools/log_decode.py formats them
+on a PC from the Formats table below.
+
+The panel shows either the log or the contact dashboard (Dashboard.c).
+While the dashboard is up, log lines still go to the RAM history and the
+log is redrawn from it when it comes back.  A view change asked for with
+Display_SetView takes effect once the queued messages have been logged.
+A buffered panel (Nokia5110) is flushed when the queue is empty and
+nothing is left to draw, once per burst of messages.
 ===================================================================== */
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 #include "Display.h"
+#include "Dashboard.h"
+#include "Log.h"
 #include "../inc/tm4c123gh6pm.h"
-#include "../inc/ST7735.h"
+#include "../inc/DisplayDev.h"
+#include "../inc/CortexM.h"
+#include "../inc/Probe.h"
+
+#define DISPLAY_COLS       21     // characters per line kept
+#define DISPLAY_SCROLLBACK 32     // lines kept in RAM, power of 2
+#define DISPLAY_BLACK      0
+#define DISPLAY_GREEN      0x07E0 // ST7735_GREEN
+
+static uint32_t Shown;            // next log record to show
+static uint32_t Dropped;          // records overwritten before they were shown
+
+// one format per message ID, 21 characters per line, '\n' starts a line
+static const char * const Formats[DISPLAY_MSG_COUNT] = {
+	[DISPLAY_MSG_INIT]              = "EE445L Final\nInitializing BLE...",
+	[DISPLAY_MSG_BOOT]              = "Connection Success\nBT stack booted:\n v%u.%u.%u-b%u",
+	[DISPLAY_MSG_HELLO_FAILED]      = "Connection Failed",
+	[DISPLAY_MSG_BAUD_FAILED]       = "Baud change failed",
+	[DISPLAY_MSG_ADDR_FAILED]       = "Failed to get address",
+	[DISPLAY_MSG_ADDR_PUBLIC]       = "Public address:\n %02X:%02X:%02X:%02X:%02X:%02X",
+	[DISPLAY_MSG_ADDR_STATIC]       = "Static random addr:\n %02X:%02X:%02X:%02X:%02X:%02X",
+	[DISPLAY_MSG_ATTR_FAILED]       = "Failed to set\n attribute",
+	[DISPLAY_MSG_ADV_SET_FAILED]    = "Failed to create\n advertising set",
+	[DISPLAY_MSG_ADV_DATA_FAILED]   = "Failed to set\n advertising data",
+	[DISPLAY_MSG_ADV_TIMING_FAILED] = "Failed to set\n advertising timing",
+	[DISPLAY_MSG_ADV_START_FAILED]  = "Failed to start\n advertising",
+	[DISPLAY_MSG_SCAN_FAILED]       = "Failed to start\n scanning",
+	[DISPLAY_MSG_BLE_READY]         = "BLE initialized",
+	[DISPLAY_MSG_CONN_OPENED]       = "New Connection Opened",
+	[DISPLAY_MSG_CONN_CLOSED]       = "Connection Closed",
+	[DISPLAY_MSG_NAME_CHANGED]      = "Device Name Changed",
+	[DISPLAY_MSG_NAME_FAILED]       = "Failed to get\n device name",
+	[DISPLAY_MSG_PROFILE_FAILED]    = "Failed to write\n user profile",
+};
+
+static char History[DISPLAY_SCROLLBACK][DISPLAY_COLS+1];
+static uint32_t Lines;  // lines logged so far, the newest is Lines-1
+static uint32_t Top;    // text row slot shown first in the scrolling area
+static uint32_t Back;   // lines scrolled back, 0 shows the newest
+static uint32_t View;   // DISPLAY_VIEW_LOG or DISPLAY_VIEW_DASHBOARD
+static uint32_t NextView;
+static int DashboardFits; // the panel can show the dashboard
+PROBE_DEF(RenderProbe, "display draw", PROBE_NOPIN)
+
+static const DisplayDev_t *Dev;
+static uint32_t RowH;     // pixels per text row
+static uint32_t Title;    // text rows above the log, 0 or 1
+static uint32_t LogRows;  // text rows below the title
+
+// draw history line n on visible log row k (0 is just below the title)
+static void drawLine(uint32_t n, uint32_t k) {
+	uint32_t row = Title + (Top + k) % LogRows;
+	Dev->fill(0, row*RowH, Dev->width, RowH, DISPLAY_BLACK);
+	if (n < Lines) {
+		Dev->text(0, row, History[n % DISPLAY_SCROLLBACK], DISPLAY_GREEN);
+	}
+}
+
+// draw every log row, ending with the line Back lines before the newest
+static void redraw(void) {
+	uint32_t k, first = 0;
+	if (Lines - Back > LogRows) {
+		first = Lines - Back - LogRows;
+	}
+	for (k = 0; k < LogRows; k++) {
+		drawLine((first + k < Lines - Back)? first + k: Lines, k);
+	}
+}
+
+// add a line to the history and show it
+static void newLine(const char *text) {
+	char *line = History[Lines % DISPLAY_SCROLLBACK];
+	uint32_t i;
+	for (i = 0; (i < DISPLAY_COLS) && text[i]; i++) {
+		line[i] = text[i];
+	}
+	line[i] = 0;
+	Lines++;
+	if (View != DISPLAY_VIEW_LOG) {     // drawn by showLog later
+		return;
+	}
+	if (Back) {                         // back to the live view
+		Back = 0;
+		redraw();
+		return;
+	}
+	if (Lines > LogRows) {              // oldest row leaves the top
+		if (Dev->scrollStart == 0) {
+			redraw();
+			return;
+		}
+		Top = (Top + 1) % LogRows;        // reuse it at the bottom
+		Dev->scrollStart((Title + Top)*RowH);
+		drawLine(Lines - 1, LogRows - 1);
+	} else {
+		drawLine(Lines - 1, Lines - 1);
+	}
+}
+
+// log each '\n' separated line of text
+static void newLines(char *text) {
+	char *end;
+	while ((end = strchr(text, '\n'))) {
+		*end = 0;
+		newLine(text);
+		text = end + 1;
+	}
+	if (*text) {
+		newLine(text);
+	}
+}
+
+// take over the panel for the log: title, scrolling area, every row
+static void showLog(void) {
+	if (Dev->scrollStart) {
+		Dev->scrollArea(Title*RowH, Dev->height - (Title + LogRows)*RowH);
+		Dev->scrollStart((Title + Top)*RowH);
+	}
+	if (Title) {
+		Dev->fill(0, 0, Dev->width, RowH, DISPLAY_BLACK);
+		Dev->text(0, 0, "UART Log:", DISPLAY_GREEN);
+	}
+	redraw();
+}
 
-static uint32_t CurX, CurY;
+// the dashboard uses the panel unscrolled
+static void showDashboard(void) {
+	if (Dev->scrollStart) {
+		Dev->scrollArea(0, 0);
+		Dev->scrollStart(0);
+	}
+	Dashboard_Invalidate();
+}
+
+// a buffered panel gets what was drawn once there is nothing left to draw
+static int idle(void) {
+	if (Dev->flush) {
+		Dev->flush();
+	}
+	return 0;
+}
+
+void Display_SetView(uint32_t view) {
+	if ((view == DISPLAY_VIEW_DASHBOARD) && !DashboardFits) {
+		return;                         // the log stays up
+	}
+	NextView = view;
+}
+
+int Display_Post(uint8_t id, const uint16_t *args, uint32_t count) {
+	if ((id >= DISPLAY_MSG_COUNT) || (count > DISPLAY_MAXARGS)) {
+		return 0;
+	}
+	Log_Post(id, args, count);
+	return 1;
+}
 
-static void moveCursor() {
-	CurX = 0;
-	if (CurY + 1 > 15) {
-		ST7735_FillScreen(ST7735_BLACK);
+static int render(void) {
+	char text[80];
+	uint16_t *a;
+	LogRec_t rec;
+	int32_t skipped = Log_Get(&Shown, &rec);
+	if (skipped < 0) {
+		if (NextView != View) {         // the log is drained, switch
+			View = NextView;
+			if (View == DISPLAY_VIEW_LOG) {
+				showLog();
+			} else {
+				showDashboard();
+			}
+			return 1;
+		}
+		if (Dropped == 0) {
+			if ((View == DISPLAY_VIEW_DASHBOARD) && Dashboard_Update()) {
+				return 1;
+			}
+			return idle();
+		}
+		snprintf(text, sizeof(text), "(%u msgs dropped)", (unsigned)Dropped);
+		Dropped = 0;                    // after the ones that made it
+		newLine(text);
+		return 1;
+	}
+	Dropped += skipped;
+	if (rec.Id >= DISPLAY_MSG_COUNT) {
+		return 1;                       // another module's record
 	}
-	CurY = (CurY + 1) % 16;
-	ST7735_SetCursor(CurX, CurY);
+	a = rec.Arg;                      // unused arguments are 0
+	snprintf(text, sizeof(text), Formats[rec.Id], a[0], a[1], a[2], a[3], a[4], a[5]);
+	newLines(text);
+	return 1;
+}
+
+int Display_Render(void) {
+	int more;
+	PROBE_BEGIN(RenderProbe);
+	more = render();
+	PROBE_END(RenderProbe);
+	return more;
 }
 
 void DisplaySend_String(char *string) {
-	ST7735_OutString(string);
-	moveCursor();
+	newLine(string);
 }
 
 void DisplaySend_Integer(int number) {
-	if (number < 0)
-		ST7735_OutString("-");
-	ST7735_OutUDec((uint32_t)number);
-	moveCursor();
-}
-
-void Display_Init() {
-	CurX = 0;
-	CurY = 0;
-	Output_Init();
-	ST7735_SetCursor(0, 0);
-	ST7735_SetTextColor(ST7735_GREEN);
-	DisplaySend_String("UART Log:");
+	char buf[12];
+	char *pt = &buf[11];
+	uint32_t n = (number < 0)? -(uint32_t)number: (uint32_t)number;
+	*pt = 0;
+	do {
+		*--pt = '0' + n % 10;
+		n = n / 10;
+	} while (n);
+	if (number < 0) {
+		*--pt = '-';
+	}
+	newLine(pt);
+}
+
+void Display_ScrollBack(uint32_t lines) {
+	uint32_t max = 0;
+	if (Lines > LogRows) {              // only what is still in RAM
+		max = Lines - LogRows;
+		if (max > DISPLAY_SCROLLBACK - LogRows) {
+			max = DISPLAY_SCROLLBACK - LogRows;
+		}
+	}
+	if (lines > max) {
+		lines = max;
+	}
+	if (lines != Back) {
+		Back = lines;
+		if (View == DISPLAY_VIEW_LOG) {
+			redraw();
+		}
+	}
+}
+
+void Display_Init(const DisplayDev_t *dev) {
+	uint32_t rows = DisplayDev_Rows(dev);
+	Dev = dev;
+	RowH = dev->charH;
+	Title = (rows > 1)? 1: 0;
+	LogRows = rows - Title;
+	if (LogRows > DISPLAY_SCROLLBACK) {
+		LogRows = DISPLAY_SCROLLBACK;
+	}
+	Lines = 0;
+	Top = 0;
+	Back = 0;
+	Dropped = 0;
+	View = NextView = DISPLAY_VIEW_LOG;
+	Shown = Log_Count();
+	Dev->init();
+	DashboardFits = Dashboard_Init(dev);
+	showLog();
 }
@@ -10,8 +10,42 @@ thus a lot of power).
 #ifndef DISPLAY_INTERFACE_H
 #define DISPLAY_INTERFACE_H
 
-/** Initialize Port A for the display. */
-void Display_Init(void);
+#include <stdint.h>
+#include "../inc/DisplayDev.h"
+#include "Log.h"
+
+#define DISPLAY_MAXARGS LOG_MAXARGS
+
+#define DISPLAY_VIEW_LOG       0  // scrolling message log
+#define DISPLAY_VIEW_DASHBOARD 1  // contact dashboard, see Dashboard.h
+
+/** Messages for Display_Post; the text of each is in Display.c. */
+enum {
+	DISPLAY_MSG_INIT,
+	DISPLAY_MSG_BOOT,               // major, minor, patch, build
+	DISPLAY_MSG_HELLO_FAILED,
+	DISPLAY_MSG_BAUD_FAILED,
+	DISPLAY_MSG_ADDR_FAILED,
+	DISPLAY_MSG_ADDR_PUBLIC,        // address bytes, most significant first
+	DISPLAY_MSG_ADDR_STATIC,        // address bytes, most significant first
+	DISPLAY_MSG_ATTR_FAILED,
+	DISPLAY_MSG_ADV_SET_FAILED,
+	DISPLAY_MSG_ADV_DATA_FAILED,
+	DISPLAY_MSG_ADV_TIMING_FAILED,
+	DISPLAY_MSG_ADV_START_FAILED,
+	DISPLAY_MSG_SCAN_FAILED,
+	DISPLAY_MSG_BLE_READY,
+	DISPLAY_MSG_CONN_OPENED,
+	DISPLAY_MSG_CONN_CLOSED,
+	DISPLAY_MSG_NAME_CHANGED,
+	DISPLAY_MSG_NAME_FAILED,
+	DISPLAY_MSG_PROFILE_FAILED,
+	DISPLAY_MSG_COUNT
+};
+
+/** Initialize the panel behind dev (e.g. &ST7735_Dev, see
+ *  inc/DisplayDev.h) and show the log on it. */
+void Display_Init(const DisplayDev_t *dev);
 
 // Send data ============================================
 
@@ -21,4 +55,27 @@ void DisplaySend_String(char*);
 /** Display the number of the display. */
 void DisplaySend_Integer(int);
 
+/** Record a message in the binary log (Log.h) without touching the panel;
+ *  safe to call from event handlers.  Display_Render shows it later.
+ *  Returns 1 if recorded, 0 for an unknown id or too many arguments. */
+int Display_Post(uint8_t id, const uint16_t *args, uint32_t count);
+
+/** Post a message that has no arguments. */
+#define Display_PostMsg(ID) Display_Post((ID), 0, 0)
+
+/** Choose what the panel shows.  The switch happens in Display_Render
+ *  once the messages already queued have been logged.  The dashboard is
+ *  not shown on a panel too small for it (see Dashboard_Init). */
+void Display_SetView(uint32_t view);
+
+/** Format and draw one queued message, or else switch views or draw one
+ *  changed dashboard region.  Call when idle.
+ *  Returns 1 if something was drawn, 0 if the panel is up to date. */
+int Display_Render(void);
+
+/** Show the log as it was the given number of lines ago, 0 for the newest.
+ *  Limited to what the RAM scrollback still holds; the next line logged
+ *  returns to the newest. */
+void Display_ScrollBack(uint32_t lines);
+
 #endif // DISPLAY_INTERFACE_H
@@ -0,0 +1,98 @@
+/* =======================Log.c=====================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Binary message log
+
+Count numbers every record ever posted; record n lives in
+Ring[n % LOG_LEN], so the ring holds records Count-LOG_LEN to Count-1.
+Posting fills the slot and bumps Count with interrupts disabled, which
+keeps records whole when a handler posts in the middle of a post or a
+Log_Get.  Readers keep their own record number, so the renderer and a
+dump do not disturb each other.
+===================================================================== */
+
+#include <stdint.h>
+#include "Log.h"
+#include "../inc/CortexM.h"
+
+static LogRec_t Ring[LOG_LEN];
+static uint32_t Count;            // records ever posted
+static uint32_t Freq;
+
+static void outU32(void (*out)(char), uint32_t value) {
+	out((char)value);
+	out((char)(value >> 8));
+	out((char)(value >> 16));
+	out((char)(value >> 24));
+}
+
+void Log_Init(uint32_t freq) {
+	Freq = freq;
+	Count = 0;
+}
+
+void Log_Post(uint8_t id, const uint16_t *args, uint32_t count) {
+	LogRec_t *rec;
+	uint32_t i;
+	long sr;
+	if (count > LOG_MAXARGS) {
+		count = LOG_MAXARGS;
+	}
+	sr = StartCritical();
+	rec = &Ring[Count & (LOG_LEN - 1)];
+	rec->Cycles = DWTCYCCNT;
+	rec->Id = id;
+	rec->Count = count;
+	for (i = 0; i < count; i++) {
+		rec->Arg[i] = args[i];
+	}
+	for (; i < LOG_MAXARGS; i++) {
+		rec->Arg[i] = 0;
+	}
+	Count++;
+	EndCritical(sr);
+}
+
+int32_t Log_Get(uint32_t *next, LogRec_t *rec) {
+	uint32_t n = *next;
+	int32_t skipped = 0;
+	long sr = StartCritical();
+	if (n == Count) {
+		EndCritical(sr);
+		return -1;
+	}
+	if (Count - n > LOG_LEN) {        // overwritten, take the oldest
+		skipped = Count - n - LOG_LEN;
+		n = Count - LOG_LEN;
+	}
+	*rec = Ring[n & (LOG_LEN - 1)];
+	EndCritical(sr);
+	*next = n + 1;
+	return skipped;
+}
+
+uint32_t Log_Count(void) {
+	return Count;
+}
+
+void Log_Dump(void (*out)(char)) {
+	uint32_t end = Count;             // records posted during the dump wait for the next one
+	uint32_t n = (end > LOG_LEN)? end - LOG_LEN: 0;
+	uint32_t total = end - n, i, k;
+	LogRec_t rec;
+	out('L'); out('O'); out('G'); out('R');
+	outU32(out, 1);
+	outU32(out, Freq);
+	outU32(out, total);
+	for (k = 0; k < total; k++) {
+		Log_Get(&n, &rec);              // a burst while sending moves n on to newer ones
+		outU32(out, rec.Cycles);
+		out((char)rec.Id);
+		out((char)rec.Count);
+		for (i = 0; i < LOG_MAXARGS; i++) {
+			out((char)rec.Arg[i]);
+			out((char)(rec.Arg[i] >> 8));
+		}
+	}
+}
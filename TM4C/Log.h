@@ -0,0 +1,60 @@
+/* =======================Log.h=====================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Binary message log.  Log_Post stores a message ID, up to six 16-bit
+arguments and the DWT cycle count in a RAM ring, with no formatting; a
+full ring overwrites its oldest records.  The text comes later, from the
+format table of whoever owns the IDs: on the device when idle (Display.c
+reads the ring with Log_Get and formats DISPLAY_MSG_ records for the
+panel), or on a PC from a dump (tools/log_decode.py, which takes the
+formats from Display.c).
+
+Log_Dump writes
+    "LOGR"  magic
+    u32     format version (1)
+    u32     cycle counter frequency in Hz
+    u32     number of records that follow
+    records, oldest first: u32 cycles, u8 id, u8 count, u16 arg[6]
+all little endian; unused arguments are 0.
+===================================================================== */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+#define LOG_LEN     64            // records kept, power of 2
+#define LOG_MAXARGS 6
+
+typedef struct {
+	uint32_t Cycles;                // DWTCYCCNT when posted
+	uint8_t Id;
+	uint8_t Count;                  // arguments used
+	uint16_t Arg[LOG_MAXARGS];      // unused ones are 0
+} LogRec_t;
+
+/** Empty the ring.  freq is the cycle counter (CPU clock) frequency in
+ *  Hz, stored in dumps; the counter itself is started by Probe_Init. */
+void Log_Init(uint32_t freq);
+
+/** Record a message.  Takes a few cycles with interrupts disabled and
+ *  never waits, so it can be called from handlers.  More than
+ *  LOG_MAXARGS arguments are cut off. */
+void Log_Post(uint8_t id, const uint16_t *args, uint32_t count);
+
+/** Copy record *next (records are numbered from 0 since Log_Init) and
+ *  move *next past it.  If it has been overwritten, the oldest record
+ *  still held is copied instead.
+ *  Returns the number of records skipped that way, or -1 if record *next
+ *  has not been posted yet. */
+int32_t Log_Get(uint32_t *next, LogRec_t *rec);
+
+/** Number of the next record to be posted. */
+uint32_t Log_Count(void);
+
+/** Write the ring, oldest record first, in the dump format above.
+ *  out sends one byte, e.g. to UART0. */
+void Log_Dump(void (*out)(char));
+
+#endif // LOG_H
@@ -0,0 +1,78 @@
+/* =======================Scheduler.c================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Event-driven main loop
+
+Ready holds one bit per event.  Handlers set bits; the loop takes the
+whole mask at once and runs the ready tasks in event order, so one task
+that keeps finding work (a burst of BLE events) cannot hide the others
+for more than one pass.  With nothing ready the idle task (the display)
+runs one step at a time, and each step is followed by a new look at
+Ready, so an event waits at most one idle step as it did when main()
+polled.  When the idle task is done too, the core sleeps.
+
+The last check of Ready and the WFI happen with interrupts disabled.
+WFI still wakes on an interrupt that is pending while PRIMASK is set, and
+its handler runs as soon as EndCritical enables interrupts, so an event
+signaled between the check and the WFI cannot leave the loop asleep.
+===================================================================== */
+
+#include <stdint.h>
+#include "Scheduler.h"
+#include "../inc/CortexM.h"
+#include "../inc/Probe.h"
+
+static int (*Tasks[SCHED_COUNT])(void);
+static int (*Idle)(void);
+static volatile uint32_t Ready;   // bit n: event n signaled, task not yet run
+PROBE_DEF(DispatchProbe, "dispatch", PROBE_NOPIN)  // one event task
+
+void Scheduler_Add(uint32_t event, int (*task)(void)) {
+	if (event < SCHED_COUNT) {
+		Tasks[event] = task;
+	}
+}
+
+void Scheduler_SetIdle(int (*task)(void)) {
+	Idle = task;
+}
+
+void Scheduler_Signal(uint32_t event) {
+	long sr = StartCritical();        // handlers of other priorities also set bits
+	Ready |= 1u << event;
+	EndCritical(sr);
+}
+
+void Scheduler_Run(void) {
+	uint32_t ready, event;
+	int more;
+	long sr;
+	while (1) {
+		sr = StartCritical();
+		ready = Ready;
+		Ready = 0;
+		EndCritical(sr);
+		if (ready) {
+			for (event = 0; event < SCHED_COUNT; event++) {
+				if ((ready & (1u << event)) && Tasks[event]) {
+					PROBE_BEGIN(DispatchProbe);
+					more = Tasks[event]();
+					PROBE_END(DispatchProbe);
+					if (more) {
+						Scheduler_Signal(event);  // more work, run it again
+					}
+				}
+			}
+			continue;
+		}
+		if (Idle && Idle()) {
+			continue;
+		}
+		sr = StartCritical();
+		if (Ready == 0) {
+			WaitForInterrupt();           // a pending interrupt ends the sleep
+		}
+		EndCritical(sr);                // and its handler runs here
+	}
+}
@@ -0,0 +1,38 @@
+/* =======================Scheduler.h================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Event-driven main loop.  Interrupt handlers only mark an event ready
+with Scheduler_Signal; Scheduler_Run calls the task of each ready event
+in the main program, then the idle task, and sleeps in WaitForInterrupt
+when neither has anything left to do.
+===================================================================== */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+/** Events, lowest number runs first. */
+enum {
+	SCHED_BLE,                      // UART1 received bytes from the NCP
+	SCHED_TICK,                     // the clock timer, once a second
+	SCHED_SW1,                      // PF4 pressed (Switch.c SW1_Event)
+	SCHED_SW2,                      // PF3 pressed (Switch.c SW2_Event)
+	SCHED_COUNT                     // at most 32
+};
+
+/** Run task in the main loop each time event is signaled.  A task returns
+ *  1 if it has more work (it is run again before the idle task) or 0. */
+void Scheduler_Add(uint32_t event, int (*task)(void));
+
+/** Run task when no event is ready, until it returns 0; then sleep. */
+void Scheduler_SetIdle(int (*task)(void));
+
+/** Mark an event ready.  Callable from interrupt handlers. */
+void Scheduler_Signal(uint32_t event);
+
+/** Dispatch events forever.  Call with interrupts enabled. */
+void Scheduler_Run(void);
+
+#endif // SCHEDULER_H
@@ -11,6 +11,9 @@ The interface for input 2 switches (PF3 and PF4).
 #define SW1       (*((volatile uint32_t *)0x40025020)) //PF3
 #define SW2       (*((volatile uint32_t *)0x40025040))  //PF4
 	
+/** Call the event functions (in the interrupt handler) when PF3 or PF4
+ *  is pressed.  Presses within 10 ms of the last one are ignored, using a
+ *  one-shot timer from Timer.h; call Timer_Init too. */
 void Switch_Init(void(*PortF3_Event)(void), void(*PortF4_Event)(void));
 
 #endif // SWITCH_H
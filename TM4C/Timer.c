@@ -1,31 +1,159 @@
+/* =======================Timer.c=====================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Hierarchical timer wheel on Timer0A
+
+Four wheels of 64 slots.  Wheel 0 has one slot per tick (the next 640
+ms), wheel 1 one slot per 64 ticks, wheel 2 per 64^2 and wheel 3 per
+64^3 ticks, 2^24 ticks (46 hours) in all.  A timer goes into the wheel
+that matches how far away it is, a doubly linked list in the slot of its
+expiry time, so Timer_Start and Timer_Stop take constant time however
+many timers are running.  Each tick runs the timers in one wheel 0 slot;
+every 64 ticks one wheel 1 slot is spread back over wheel 0 (and every
+64^2 ticks one wheel 2 slot over wheel 1, ...).  Each timer is moved at
+most three times in its life, so the work per tick is constant on
+average however far away the timers are.
+===================================================================== */
+
+#include <stdint.h>
 #include "Timer.h"
 #include "../inc/tm4c123gh6pm.h"
-#include "../inc/LaunchPad.h"
-
-void (*Period_Task)(void);
-
-void Timer0A_Init1HzInt(void (*task)(void)){
-  volatile uint32_t delay;
-  // **** general initialization ****
-  SYSCTL_RCGCTIMER_R |= 0x01;      // activate timer0
-  delay = SYSCTL_RCGCTIMER_R;      // allow time to finish activating
-  TIMER0_CTL_R &= ~TIMER_CTL_TAEN; // disable timer0A during setup
-  TIMER0_CFG_R = 0;                // configure for 32-bit timer mode
-  // **** timer0A initialization ****
-                                   // configure for periodic mode
-  TIMER0_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
-  TIMER0_TAILR_R = 79999999;         // start value for 100 Hz interrupts
-  TIMER0_IMR_R |= TIMER_IMR_TATOIM;// enable timeout (rollover) interrupt
-  TIMER0_ICR_R = TIMER_ICR_TATOCINT;// clear timer0A timeout flag
-  TIMER0_CTL_R |= TIMER_CTL_TAEN;  // enable timer0A 32-b, periodic, interrupts
-  // **** interrupt initialization ****
-                                   // Timer0A=priority 2
-  NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x40000000; // top 3 bits
-  NVIC_EN0_R = 1<<19;              // enable interrupt 19 in NVIC
-	Period_Task = task;
-}
-
-void Timer0A_Handler(void){
-  TIMER0_ICR_R = TIMER_ICR_TATOCINT;
-	(*Period_Task)();
+#include "../inc/CortexM.h"
+#include "../inc/Clock.h"
+#include "../inc/Probe.h"
+
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  (1u << WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEELS       4
+#define TIMER_MAXTICKS ((1u << (WHEEL_BITS*WHEELS)) - 1)
+
+static Timer_t *Wheel[WHEELS][WHEEL_SLOTS];
+PROBE_DEF(TickProbe, "timer tick", PROBE_NOPIN)
+static volatile uint32_t Now;     // ticks run so far; slot Now&WHEEL_MASK is next
+
+// link timer into the slot for its Expires, interrupts disabled
+static void insert(Timer_t *timer) {
+	uint32_t ahead = timer->Expires - Now;
+	uint32_t level = 0;
+	Timer_t **slot;
+	if ((int32_t)ahead < 0) {         // late: run on the next tick
+		timer->Expires = Now;
+		ahead = 0;
+	} else if (ahead > TIMER_MAXTICKS) {
+		timer->Expires = Now + TIMER_MAXTICKS;
+		ahead = TIMER_MAXTICKS;
+	}
+	while (ahead >= WHEEL_SLOTS) {
+		ahead >>= WHEEL_BITS;
+		level++;
+	}
+	slot = &Wheel[level][(timer->Expires >> (level*WHEEL_BITS)) & WHEEL_MASK];
+	timer->Next = *slot;
+	if (*slot) {
+		(*slot)->Prev = &timer->Next;
+	}
+	*slot = timer;
+	timer->Prev = slot;
+}
+
+// unlink timer, interrupts disabled
+static void unlink(Timer_t *timer) {
+	if (timer->Prev) {
+		*timer->Prev = timer->Next;
+		if (timer->Next) {
+			timer->Next->Prev = timer->Prev;
+		}
+		timer->Prev = 0;
+	}
+}
+
+// move every timer of a slot one wheel down; returns the slot index so
+// the caller cascades the next wheel too when it is 0
+static uint32_t cascade(uint32_t level) {
+	uint32_t index = (Now >> (level*WHEEL_BITS)) & WHEEL_MASK;
+	Timer_t *timer = Wheel[level][index];
+	Timer_t *next;
+	Wheel[level][index] = 0;
+	while (timer) {
+		next = timer->Next;
+		insert(timer);                  // now less than a slot of level away
+		timer = next;
+	}
+	return index;
+}
+
+void Timer_Init(void) {
+	volatile uint32_t delay;
+	SYSCTL_RCGCTIMER_R |= 0x01;       // activate timer0
+	delay = SYSCTL_RCGCTIMER_R;       // allow time to finish activating
+	TIMER0_CTL_R &= ~TIMER_CTL_TAEN;  // disable timer0A during setup
+	TIMER0_CFG_R = 0;                 // configure for 32-bit timer mode
+	TIMER0_TAMR_R = TIMER_TAMR_TAMR_PERIOD;
+	TIMER0_TAILR_R = Clock_GetFreq()/1000*TIMER_TICKMS - 1;
+	TIMER0_TAPR_R = 0;                // bus clock resolution
+	TIMER0_IMR_R |= TIMER_IMR_TATOIM; // enable timeout (rollover) interrupt
+	TIMER0_ICR_R = TIMER_ICR_TATOCINT;// clear timer0A timeout flag
+	TIMER0_CTL_R |= TIMER_CTL_TAEN;   // enable timer0A 32-b, periodic, interrupts
+	                                  // Timer0A=priority 2
+	NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|0x40000000; // top 3 bits
+	NVIC_EN0_R = 1<<19;               // enable interrupt 19 in NVIC
+}
+
+void Timer_Start(Timer_t *timer, uint32_t delay, uint32_t period, void (*task)(void)) {
+	uint32_t ticks = (delay + TIMER_TICKMS - 1)/TIMER_TICKMS;
+	long sr = StartCritical();
+	unlink(timer);
+	timer->Task = task;
+	timer->Period = (period + TIMER_TICKMS - 1)/TIMER_TICKMS;
+	timer->Expires = Now + ticks;     // slot Now runs on the next tick, a part one
+	insert(timer);
+	EndCritical(sr);
+}
+
+void Timer_Stop(Timer_t *timer) {
+	long sr = StartCritical();
+	unlink(timer);
+	EndCritical(sr);
+}
+
+int Timer_Running(const Timer_t *timer) {
+	return timer->Prev != 0;
+}
+
+uint32_t Timer_Now(void) {
+	return Now;
+}
+
+void Timer0A_Handler(void) {
+	uint32_t index = Now & WHEEL_MASK;
+	uint32_t level;
+	Timer_t *due, *timer;
+	long sr;
+	PROBE_BEGIN(TickProbe);
+	TIMER0_ICR_R = TIMER_ICR_TATOCINT;
+	sr = StartCritical();             // a higher priority ISR may start or stop timers
+	if (index == 0) {                 // wheel 0 went around, refill it
+		for (level = 1; (level < WHEELS) && (cascade(level) == 0); level++) {
+		}
+	}
+	due = Wheel[0][index];            // take the slot out, then move Now on, so
+	Wheel[0][index] = 0;              // a timer restarted or late lands in a later
+	if (due) {                        // slot, not back in the one being run
+		due->Prev = &due;
+	}
+	Now++;
+	while ((timer = due)) {
+		unlink(timer);
+		if (timer->Period) {            // before the task, which may stop it
+			timer->Expires += timer->Period;
+			insert(timer);
+		}
+		EndCritical(sr);                // tasks run with interrupts enabled
+		timer->Task();
+		sr = StartCritical();
+	}
+	EndCritical(sr);
+	PROBE_END(TickProbe);
 }
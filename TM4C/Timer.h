@@ -1,6 +1,48 @@
+/* =======================Timer.h=====================================
+Created by: Benjamin Fa, Faiyaz Mostofa, Melissa Yang, and Yongye Zhu
+EE445L Fall 2020 for McDermott, Mark
+
+Software timers on Timer0A.  Any number of one-shot and periodic
+callbacks share the one hardware timer, which interrupts every
+TIMER_TICKMS milliseconds.  Each callback has a Timer_t that the caller
+owns (static or global), so there is nothing to allocate.  Callbacks run
+in the Timer0A interrupt handler: keep them short, and hand longer work
+to the main loop with Scheduler_Signal.
+===================================================================== */
+
 #ifndef _TIMERH_
 #define _TIMERH_
 
-void Timer0A_Init1HzInt(void (*task)(void));
+#include <stdint.h>
+
+#define TIMER_TICKMS 10          // resolution, ms per Timer0A interrupt
+
+typedef struct Timer_s {
+	struct Timer_s *Next;          // in a wheel slot
+	struct Timer_s **Prev;         // link that points here, 0 if stopped
+	uint32_t Expires;              // tick it runs on
+	uint32_t Period;               // ticks, 0 for one-shot
+	void (*Task)(void);
+} Timer_t;
+
+/** Start Timer0A interrupting every TIMER_TICKMS, priority 2. */
+void Timer_Init(void);
+
+/** Run task once after delay ms, then every period ms (0 for one-shot).
+ *  Restarts the timer if it is already running.  The first run comes
+ *  at least delay and at most delay + TIMER_TICKMS ms later; periods are
+ *  rounded up to whole ticks.  Delays are limited to about 46 hours. */
+void Timer_Start(Timer_t *timer, uint32_t delay, uint32_t period, void (*task)(void));
+
+/** Stop the timer if it is running.  Safe from its own task.
+ *  Timer_Start and Timer_Stop are callable from the main program, from
+ *  the tasks and from any interrupt handler, whatever its priority. */
+void Timer_Stop(Timer_t *timer);
+
+/** Returns 1 if the timer is waiting to run, 0 if not. */
+int Timer_Running(const Timer_t *timer);
+
+/** Ticks since Timer_Init, wraps after 497 days. */
+uint32_t Timer_Now(void);
 
 #endif
@@ -1,6 +1,6 @@
 // UARTTestMain.c
 // Runs on LM4F120/TM4C123
-// Used to test the UART.c driver
+// Used to test the UART0 driver (UART0int.c)
 // Daniel Valvano
 // Jan 3, 2020
 
@@ -7,33 +7,32 @@ The main method for the entire system.
 
 #include <stdint.h>
 #include "../inc/user.h"
-#include "../inc/PLL.h"
+#include "../inc/Clock.h"
 #include "../inc/CortexM.h"
 #include "Switch.h"
 #include "BLEHandler.h"
 #include "AppHandler.h"
 #include "Display.h"
+#include "Dashboard.h"
 #include "../inc/UART1int.h"
 #include "./BGLib/sl_bt_api.h"
 #include "./BGLib/sl_bt_ncp_host.h"
-#include "../inc/ST7735.h"
+#include "../inc/DisplayDev.h"
 #include "Timer.h"
+#include "Scheduler.h"
+#include "Log.h"
+#include "../inc/Probe.h"
 
-void FakeMessage() {
-	char fakeContact[] = "ID:1234c0de:11:3";
-	char fakeMsg[32];
-	int i = 0;
-	while(fakeContact[i]) {
-		fakeMsg[i] = fakeContact[i];
-		i++;
-	}
-	fakeMsg[i++] = 0xff;
-	fakeMsg[i] = '\0';
-	UART1_OutString(fakeMsg);
-}
+// SCHED_BLE is signaled from UART1's receive interrupts.  With uDMA the
+// receive time-out never fires, so a short NCP frame would not wake the
+// scheduler; UART1int.c has to be built without UART1_DMA.
+#if defined(UART1_DMA) && UART1_DMA
+#error "the scheduler needs UART1_SetRxTask, build UART1int.c with UART1_DMA 0"
+#endif
 
-extern int time;
+static int time;
 static int second;
+static Timer_t ClockTimer;
 uint8_t month;
 uint8_t day;
 uint8_t year;
@@ -103,17 +102,58 @@ void Timer_Task(){
 	else{
 		second += 1;
 	}
+	Scheduler_Signal(SCHED_TICK);
+}
+
+// Interrupt handlers only signal; these run in the main program =====
+
+void BLE_Received(void){
+	Scheduler_Signal(SCHED_BLE);
+}
+
+void Switch1_Pressed(void){
+	Scheduler_Signal(SCHED_SW1);
+}
+
+void Switch2_Pressed(void){
+	Scheduler_Signal(SCHED_SW2);
+}
+
+static int tickTask(void){
+	Dashboard_SetTime(time);
+	return 0;
+}
+
+static int switch1Task(void){
+	BLEHandler_StatsDump();             // FIFO, UART1 and probe statistics
+	return 0;
+}
+
+static int switch2Task(void){
+	BLEHandler_TraceDump();             // BGAPI trace, then the message log
+	return 0;
 }
 
 int main(void) 
 {
 	DisableInterrupts();
 	char input[256];
-	PLL_Init(Bus80MHz);
-	Display_Init();
-	//Switch_Init(&BLESwitch_Advertisement,&FakeMessage);
-	Timer0A_Init1HzInt(&Timer_Task);
+	Clock_InitFastest(); // 80 MHz, UART divisors use Clock_GetFreq
+	Probe_Init(0);       // cycle counter only; PC5 (Profile 5) is UART1 TX
+	Log_Init(Clock_GetFreq());
+	Display_Init(&ST7735_Dev);
+	Timer_Init();
+	Timer_Start(&ClockTimer, 1000, 1000, &Timer_Task);
+	Switch_Init(&Switch1_Pressed,&Switch2_Pressed);
 	BLEHandler_Init();
+	UART1_SetRxTask(&BLE_Received);
+	Scheduler_Add(SCHED_BLE, &BLEHandler_Main_Loop);
+	Scheduler_Add(SCHED_TICK, &tickTask);
+	Scheduler_Add(SCHED_SW1, &switch1Task);
+	Scheduler_Add(SCHED_SW2, &switch2Task);
+	Scheduler_SetIdle(&Display_Render); // draw only when no event is waiting
+	Scheduler_Signal(SCHED_BLE);        // bytes received during BLEHandler_Init
+	Scheduler_Signal(SCHED_TICK);
   EnableInterrupts();
 //	sl_status_t sc;
 //	sc = sl_bt_system_hello();
@@ -125,9 +165,6 @@ int main(void)
 	day = 27;
 	year = 20;
 	
-	ST7735_OutString("\nHello WOrld");
-	while (1) {
-		
-		BLEHandler_Main_Loop();
-	}
+	DisplaySend_String("Hello WOrld");
+	Scheduler_Run();                    // sleeps when there is nothing to do
 }
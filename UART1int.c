@@ -1,346 +0,0 @@
-// UART1int.c
-// Runs on LM4F120/TM4C123
-// Use UART1 to implement bidirectional data transfer to and from another microcontroller
-// U1Rx PC4 is RxD (input to this microcontroller)
-// U1Tx PC5 is TxD (output of this microcontroller)
-// interrupts and FIFO used for receiver, busy-wait on transmit.
-// Daniel Valvano
-// Jan 3, 2020
-
-
-/* This example accompanies the book
-   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
-   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2020
-   Program 5.11 Section 5.6, Program 3.10
-
- Copyright 2020 by Jonathan W. Valvano, valvano@mail.utexas.edu
-    You may use, edit, run or distribute this file
-    as long as the above copyright notice remains
- THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
- OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
- MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
- VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
- OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
- For more information about my classes, my research, and my books, see
- http://users.ece.utexas.edu/~valvano/
- */
-
-
-#include <stdint.h>
-#include "../inc/tm4c123gh6pm.h"
-#include "../inc/CortexM.h"
-#include "../inc/UART1int.h"
-#include "../inc/FIFO.h"
-
-#define FIFOSIZE   1024       // size of the FIFOs (must be power of 2)
-#define FIFOSUCCESS 1        // return value on success
-#define FIFOFAIL    0        // return value on failure
-
-AddIndexFifo(Rx, FIFOSIZE, char, FIFOSUCCESS, FIFOFAIL)
-AddIndexFifo(Tx, 1024, char, FIFOSUCCESS, FIFOFAIL)
-                  
-//------------UART1_InStatus------------
-// Returns how much data available for reading
-// Input: none
-// Output: number of elements in receive FIFO
-uint32_t UART1_InStatus(void){  
- return ((RxPutI - RxGetI)&(FIFOSIZE-1));  
-}
-
-#define NVIC_EN0_INT6           0x00000040  // Interrupt 6 enable
-
-#define UART_FR_TXFE            0x00000080  // UART Transmit FIFO Empty
-#define UART_FR_RXFF            0x00000040  // UART Receive FIFO Full
-#define UART_FR_TXFF            0x00000020  // UART Transmit FIFO Full
-#define UART_FR_RXFE            0x00000010  // UART Receive FIFO Empty
-#define UART_FR_BUSY            0x00000008  // UART Transmit Busy
-#define UART_LCRH_WLEN_8        0x00000060  // 8 bit word length
-#define UART_LCRH_FEN           0x00000010  // UART Enable FIFOs
-#define UART_CTL_UARTEN         0x00000001  // UART Enable
-#define UART_IFLS_RX1_8         0x00000000  // RX FIFO >= 1/8 full
-#define UART_IFLS_TX1_8         0x00000000  // TX FIFO <= 1/8 full
-#define UART_IM_RTIM            0x00000040  // UART Receive Time-Out Interrupt
-                                            // Mask
-#define UART_IM_TXIM            0x00000020  // UART Transmit Interrupt Mask
-#define UART_IM_RXIM            0x00000010  // UART Receive Interrupt Mask
-#define UART_RIS_RTRIS          0x00000040  // UART Receive Time-Out Raw
-                                            // Interrupt Status
-#define UART_RIS_TXRIS          0x00000020  // UART Transmit Raw Interrupt
-                                            // Status
-#define UART_RIS_RXRIS          0x00000010  // UART Receive Raw Interrupt
-                                            // Status
-#define UART_ICR_RTIC           0x00000040  // Receive Time-Out Interrupt Clear
-#define UART_ICR_TXIC           0x00000020  // Transmit Interrupt Clear
-#define UART_ICR_RXIC           0x00000010  // Receive Interrupt Clear
-
-//------------UART1_Init------------
-// Initialize the UART1 on PortC 115,200 baud rate (assuming 80 MHz clock),
-// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
-// Input: none
-// Output: none
-void UART1_Init(void){
-  SYSCTL_RCGCUART_R |= 0x0002;		// activate UART1
-	SYSCTL_RCGCGPIO_R |= 0x0004;		// activate PortC
-  RxFifo_Init();                        // initialize empty FIFOs
-  TxFifo_Init();	
-	
-	UART1_CTL_R &= ~UART_CTL_UARTEN;					// disable UART
-	UART1_IBRD_R = 43;							// 80MHz, was 27
-	UART1_FBRD_R = 26; 							// 80MHz, was 8
-	//UART1_LCRH_R = 0x0070;
-	UART1_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-	
-	//Init for Rx and Tx
-	//UART1_IM_R |= 0x10;
-	//UART1_IFLS_R &= ~0x38; 
-	//UART1_IFLS_R |= 0x10;
-	UART1_IM_R |= (UART_IM_RXIM|UART_IM_TXIM|UART_IM_RTIM);
-	UART1_IFLS_R &= ~0x3F;                // clear TX and RX interrupt FIFO level fields
-                                        // configure interrupt for TX FIFO <= 1/8 full
-                                        // configure interrupt for RX FIFO >= 1/8 full
-  UART1_IFLS_R += (UART_IFLS_TX1_8|UART_IFLS_RX1_8);
-                                        // enable TX and RX FIFO interrupts and RX time-out interrupt
-	NVIC_PRI1_R = (NVIC_PRI1_R&~0x70000)+0x70000;
-	NVIC_EN0_R |= 0x40;
-
-	
-	UART1_CTL_R = 0x0301;
-	GPIO_PORTC_AFSEL_R |= 0x30; 		//alt func 
-	GPIO_PORTC_PCTL_R |= (GPIO_PORTC_PCTL_R&0xFF00FFFF)+0x00220000;
-	GPIO_PORTC_DEN_R |= 0x30;				// digital I/O on PC5-4
-	GPIO_PORTC_AMSEL_R &= ~0x30; 		// no analog on PC5-4
-}
-// copy from hardware RX FIFO to software RX FIFO
-// stop when hardware RX FIFO is empty or software RX FIFO is full
-void static copyHardwareToSoftware(void){
-  char letter;
-  while(((UART1_FR_R&UART_FR_RXFE) == 0) && (RxFifo_Size() < (FIFOSIZE - 1))){
-    letter = UART1_DR_R;
-    RxFifo_Put(letter);
-  }
-}
-
-// copy from software TX FIFO to hardware TX FIFO
-// stop when software TX FIFO is empty or hardware TX FIFO is full
-void static copySoftwareToHardware(void){
-  char letter;
-  while(((UART1_FR_R&UART_FR_TXFF) == 0) && (TxFifo_Size() > 0)){
-    TxFifo_Get(&letter);
-    UART1_DR_R = letter;
-  }
-}
-
-// input ASCII character from UART
-// spin if RxFifo is empty
-char UART1_InChar(void){
-  char letter;
-  while(RxFifo_Get(&letter) == FIFOFAIL){};
-  return(letter);
-}
-
-//------------UART_InCharNonBlock------------
-// input ASCII character from UART
-// output: 0 if RxFifo is empty
-//         character if
-char UART_InCharNonBlock(void){
-  char letter;
-  if(RxFifo_Get(&letter) == FIFOFAIL){
-    return 0;  // empty
-  };
-  return(letter);
-}
-
-//------------UART1_OutChar------------
-// Output 8-bit to serial port
-// Input: letter is an 8-bit ASCII character to be transferred
-// Output: none
-void UART1_OutChar(char data){
-  while(TxFifo_Put(data) == FIFOFAIL){};
-  UART1_IM_R &= ~UART_IM_TXIM;          // disable TX FIFO interrupt
-  copySoftwareToHardware();
-  UART1_IM_R |= UART_IM_TXIM;           // enable TX FIFO interrupt
-}
-
-//------------UART1_OutCharNonBlock------------
-// non blocking output ASCII character to UART
-// Input: letter is an 8-bit ASCII character to be transferred
-// Output: none
-// Error: return with lost data if TxFifo is full
-void UART1_OutCharNonBlock(char data){
-  if(TxFifo_Put(data) == FIFOFAIL) return; // lost data
-  UART1_IM_R &= ~UART_IM_TXIM;          // disable TX FIFO interrupt
-  copySoftwareToHardware();
-  UART1_IM_R |= UART_IM_TXIM;           // enable TX FIFO interrupt
-}
-
-// at least one of three things has happened:
-// hardware TX FIFO goes from 3 to 2 or less items
-// hardware RX FIFO goes from 1 to 2 or more items
-// UART receiver has timed out
-void UART1_Handler(void){
-  if(UART1_RIS_R&UART_RIS_TXRIS){       // hardware TX FIFO <= 2 items
-    UART1_ICR_R = UART_ICR_TXIC;        // acknowledge TX FIFO
-    // copy from software TX FIFO to hardware TX FIFO
-    copySoftwareToHardware();
-    if(TxFifo_Size() == 0){             // software TX FIFO is empty
-      UART1_IM_R &= ~UART_IM_TXIM;      // disable TX FIFO interrupt
-    }
-  }
-  if(UART1_RIS_R&UART_RIS_RXRIS){       // hardware RX FIFO >= 2 items
-    UART1_ICR_R = UART_ICR_RXIC;        // acknowledge RX FIFO
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-//  if(UART1_RIS_R&UART_RIS_RTRIS){       // receiver timed out
-//    UART1_ICR_R = UART_ICR_RTIC;        // acknowledge receiver time out
-//    // copy from hardware RX FIFO to software RX FIFO
-//    copyHardwareToSoftware();
-//  }
-}
-
-//------------UART1_OutString------------
-// Output String (NULL termination)
-// Input: pointer to a NULL-terminated string to be transferred
-// Output: none
-void UART1_OutString(char *pt){
-  while(*pt){
-    UART1_OutChar(*pt);
-    pt++;
-  }
-}
-
-//------------UART_InUDec------------
-// InUDec accepts ASCII input in unsigned decimal format
-//     and converts to a 32-bit unsigned number
-//     valid range is 0 to 4294967295 (2^32-1)
-// Input: none
-// Output: 32-bit unsigned number
-// If you enter a number above 4294967295, it will return an incorrect value
-// Backspace will remove last digit typed
-uint32_t UART_InUDec(void){
-uint32_t number=0, length=0;
-char character;
-  character = UART1_InChar();
-  while(character != CR){ // accepts until <enter> is typed
-// The next line checks that the input is a digit, 0-9.
-// If the character is not 0-9, it is ignored and not echoed
-    if((character>='0') && (character<='9')) {
-      number = 10*number+(character-'0');   // this line overflows if above 4294967295
-      length++;
-      UART1_OutChar(character);
-    }
-// If the input is a backspace, then the return number is
-// changed and a backspace is outputted to the screen
-    else if((character==BS) && length){
-      number /= 10;
-      length--;
-      UART1_OutChar(character);
-    }
-    character = UART1_InChar();
-  }
-  return number;
-}
-
-//-----------------------UART1_OutUDec-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void UART1_OutUDec(uint32_t n){
-// This function uses recursion to convert decimal number
-//   of unspecified length as an ASCII string
-  if(n >= 10){
-    UART1_OutUDec(n/10);
-    n = n%10;
-  }
-  UART1_OutChar((char)(n+'0')); /* n is between 0 and 9 */
-}
-
-//-----------------------UART_OutSDec-----------------------
-// Output a 32-bit number in signed decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void UART_OutSDec(long n){
-  if(n<0){
-    UART1_OutChar('-');
-    n = -n;
-  }
-  UART1_OutUDec((unsigned long)n);
-}
-
-//---------------------UART_InUHex----------------------------------------
-// Accepts ASCII input in unsigned hexadecimal (base 16) format
-// Input: none
-// Output: 32-bit unsigned number
-// No '$' or '0x' need be entered, just the 1 to 8 hex digits
-// It will convert lower case a-f to uppercase A-F
-//     and converts to a 16 bit unsigned number
-//     value range is 0 to FFFFFFFF
-// If you enter a number above FFFFFFFF, it will return an incorrect value
-// Backspace will remove last digit typed
-uint32_t UART_InUHex(void){
-uint32_t number=0, digit, length=0;
-char character;
-  character = UART1_InChar();
-  while(character != CR){
-    digit = 0x10; // assume bad
-    if((character>='0') && (character<='9')){
-      digit = character-'0';
-    }
-    else if((character>='A') && (character<='F')){
-      digit = (character-'A')+0xA;
-    }
-    else if((character>='a') && (character<='f')){
-      digit = (character-'a')+0xA;
-    }
-// If the character is not 0-9 or A-F, it is ignored and not echoed
-    if(digit <= 0xF){
-      number = number*0x10+digit;
-      length++;
-      UART1_OutChar(character);
-    }
-// Backspace outputted and return value changed if a backspace is inputted
-    else if((character==BS) && length){
-      number /= 0x10;
-      length--;
-      UART1_OutChar(character);
-    }
-    character = UART1_InChar();
-  }
-  return number;
-}
-
-//--------------------------UART_OutUHex----------------------------
-// Output a 32-bit number in unsigned hexadecimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1 to 8 digits with no space before or after
-void UART_OutUHex(uint32_t number){
-// This function uses recursion to convert the number of
-//   unspecified length as an ASCII string
-  if(number >= 0x10){
-    UART_OutUHex(number/0x10);
-    UART_OutUHex(number%0x10);
-  }
-  else{
-    if(number < 0xA){
-      UART1_OutChar(number+'0');
-     }
-    else{
-      UART1_OutChar((number-0x0A)+'A');
-    }
-  }
-}
-
-//------------UART1_FinishOutput------------
-// Wait for all transmission to finish
-// Input: none
-// Output: none
-void UART1_FinishOutput(void){
-  // Wait for entire tx message to be sent
-  // UART Transmit FIFO Empty =1, when Tx done
-  while((UART1_FR_R&UART_FR_TXFE) == 0);
-  // wait until not busy
-  while((UART1_FR_R&UART_FR_BUSY));
-}
@@ -0,0 +1,57 @@
+// AGM1264FDev.c
+// Runs on TM4C123
+// DisplayDev_t adapter for the AGM1264F 128x64 graphics LCD (AGM1264F.c).
+// The driver writes whole bytes of display RAM and cannot read them
+// back, so only its text cells are used: 6x8 pixels, 21 by 8.  Fill
+// writes spaces over every cell the rectangle touches; there is no blit.
+
+#include <stdint.h>
+#include "DisplayDev.h"
+#include "AGM1264F.h"
+
+#define AGM_COLS 21
+#define AGM_ROWS 8
+
+static void agmInit(void){
+  LCD_Init();
+  LCD_Clear(0);
+}
+
+static void agmFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  int16_t col, row, left, right, bottom;
+  if((w <= 0) || (h <= 0)) return;
+  left = (x < 0)? 0: x/6;
+  right = (x + w + 5)/6;               // cells touched, rounded out
+  if(right > AGM_COLS) right = AGM_COLS;
+  row = (y < 0)? 0: y/8;
+  bottom = (y + h + 7)/8;
+  if(bottom > AGM_ROWS) bottom = AGM_ROWS;
+  for(; row < bottom; row++){
+    LCD_GoTo(row + 1, left + 1);
+    for(col = left; col < right; col++){
+      LCD_OutChar(' ');
+    }
+  }
+}
+
+static uint32_t agmText(uint16_t col, uint16_t row, const char *pt, uint16_t color){
+  uint32_t count = 0;
+  if((row >= AGM_ROWS) || (col >= AGM_COLS)) return 0;
+  LCD_GoTo(row + 1, col + 1);
+  while(*pt && (col + count < AGM_COLS)){
+    LCD_OutChar(*pt);
+    pt++;
+    count++;
+  }
+  return count;
+}
+
+const DisplayDev_t AGM1264F_Dev = {
+  "AGM1264F", 128, 64, 6, 8, DISPLAYDEV_TEXTONLY,
+  agmInit,
+  agmFill,
+  0,                                 // no readback, no blit
+  agmText,
+  0,                                 // draws immediately
+  0, 0                               // no hardware scrolling
+};
@@ -10,7 +10,7 @@
 //    cc2650lp_simple_np_uart_pm_xsbl_mooc_custom.hex 
 //    simple_np_cc2650lp_uart_pm_sbl.hex
 // It doesn't matter if bootloadmode is enabled (sbl) or not enabled (xsbl)
-// Transmit and receive interrupts are implemented in UART1.c on UCA2.
+// Transmit and receive interrupts are implemented in UART1int.c (UARTx.c).
 // GPIO pins are implemented in GPIO.c
 // Daniel Valvano and Jonathan Valvano
 // Jan 3, 2020
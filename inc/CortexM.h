@@ -21,6 +21,8 @@
  For more information about my classes, my research, and my books, see
  http://users.ece.utexas.edu/~valvano/
  */
+#ifndef __CORTEXM_H__
+#define __CORTEXM_H__
 #include <stdint.h>
 
 #define STCTRL          (*((volatile uint32_t *)0xE000E010))
@@ -35,6 +37,11 @@
 #define HFAULTSTAT      (*((volatile uint32_t *)0xE000ED2C))
 #define MMADDR          (*((volatile uint32_t *)0xE000ED34))
 #define FAULTADDR       (*((volatile uint32_t *)0xE000ED38))
+#define DEMCR           (*((volatile uint32_t *)0xE000EDFC))
+#define DEMCR_TRCENA    0x01000000  // enable DWT and ITM
+#define DWTCTRL         (*((volatile uint32_t *)0xE0001000))
+#define DWTCTRL_CYCCNTENA 0x00000001 // enable the cycle counter
+#define DWTCYCCNT       (*((volatile uint32_t *)0xE0001004))
 
 // these functions are defined in the startup file
 
@@ -79,5 +86,4 @@ void Clock_Delay(uint32_t ulCount);
 // Outputs: none
 void Clock_Delay1ms(uint32_t n);
 
-
-
+#endif
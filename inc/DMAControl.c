@@ -0,0 +1,49 @@
+// DMAControl.c
+// Runs on LM4F120/TM4C123
+// Shared uDMA channel control table.  The uDMA controller has exactly
+// one control table, so every driver that uses DMA in the same program
+// must share it.  See DMASPI.c and DMATimerRead.c for the single-purpose
+// versions this was taken from.
+
+#include <stdint.h>
+#include "../inc/tm4c123gh6pm.h"
+#include "../inc/DMAControl.h"
+
+// The control table used by the uDMA controller.  This table must be aligned to a 1024 byte boundary.
+// each channel has source,destination,control,pad (pad word is ignored)
+uint32_t ucControlTable[256] __attribute__ ((aligned(1024)));
+
+static uint8_t DMAControl_Ready = 0;
+
+// ************DMAControl_Init*****************
+// Enable the uDMA controller and point it at the shared control table.
+// Safe to call from every driver that uses DMA; only the first call
+// clears the table.
+// Inputs:  none
+// Outputs: none
+void DMAControl_Init(void){ int i;
+  volatile uint32_t delay;
+  if(DMAControl_Ready){
+    return;                   // another driver already set it up
+  }
+  for(i=0; i<256; i++){
+    ucControlTable[i] = 0;
+  }
+  SYSCTL_RCGCDMA_R = 0x01;    // uDMA Module Run Mode Clock Gating Control
+  delay = SYSCTL_RCGCDMA_R;   // allow time to finish
+  UDMA_CFG_R = 0x01;          // MASTEN Controller Master Enable
+  UDMA_CTLBASE_R = (uint32_t)ucControlTable;
+  DMAControl_Ready = 1;
+}
+
+// ************DMAControl_Remaining*****************
+// Number of items a control structure still has to move
+// Inputs:  index of the structure (DMA_PRI(ch) or DMA_ALT(ch))
+// Outputs: 0 if the structure is done (stopped), otherwise items left
+uint32_t DMAControl_Remaining(uint32_t index){
+  uint32_t control = ucControlTable[index+2];
+  if((control&DMA_MODE_M) == DMA_MODE_STOP){
+    return 0;
+  }
+  return ((control&DMA_XFERSIZE_M)>>4)+1;
+}
@@ -0,0 +1,57 @@
+// DMAControl.h
+// Runs on LM4F120/TM4C123
+// Shared uDMA channel control table.  The uDMA controller has exactly
+// one control table, so every driver that uses DMA in the same program
+// (UART1 streaming, SSI0 pixel streaming, ...) must share it instead of
+// declaring its own copy the way the single-purpose DMA examples do.
+// Each channel has source,destination,control,pad (pad word is ignored)
+// at index 4*ch (primary structure) and 4*ch+128 (alternate structure).
+
+#ifndef __DMACONTROL_H__
+#define __DMACONTROL_H__
+#include <stdint.h>
+
+// The control table used by the uDMA controller, aligned to 1024 bytes
+extern uint32_t ucControlTable[256];
+
+// index of the primary and alternate control structures for a channel
+#define DMA_PRI(ch)   ((ch)*4)
+#define DMA_ALT(ch)   ((ch)*4+128)
+
+// DMACHCTL fields used by the drivers
+#define DMA_DSTINC_8     0x00000000  // 8-bit destination address increment
+#define DMA_DSTINC_16    0x40000000  // 16-bit destination address increment
+#define DMA_DSTINC_NONE  0xC0000000  // no destination address increment
+#define DMA_DSTSIZE_8    0x00000000  // 8-bit destination data size
+#define DMA_DSTSIZE_16   0x10000000  // 16-bit destination data size
+#define DMA_SRCINC_8     0x00000000  // 8-bit source address increment
+#define DMA_SRCINC_16    0x04000000  // 16-bit source address increment
+#define DMA_SRCINC_NONE  0x0C000000  // no source address increment
+#define DMA_SRCSIZE_8    0x00000000  // 8-bit source data size
+#define DMA_SRCSIZE_16   0x01000000  // 16-bit source data size
+#define DMA_ARB_1        0x00000000  // arbitrates after 1 transfer
+#define DMA_ARB_4        0x00008000  // arbitrates after 4 transfers
+#define DMA_ARB_8        0x0000C000  // arbitrates after 8 transfers
+#define DMA_XFERSIZE(n)  ((((uint32_t)(n))-1)<<4) // transfer count items
+#define DMA_XFERSIZE_M   0x00003FF0  // XFERSIZE field
+#define DMA_MODE_M       0x00000007  // XFERMODE field, 0 when done
+#define DMA_MODE_STOP    0x00000000
+#define DMA_MODE_BASIC   0x00000001
+#define DMA_MODE_PINGPONG 0x00000003
+#define DMA_MAXITEMS     1024        // maximum items in one structure
+
+// ************DMAControl_Init*****************
+// Enable the uDMA controller and point it at the shared control table.
+// Safe to call from every driver that uses DMA; only the first call
+// clears the table.
+// Inputs:  none
+// Outputs: none
+void DMAControl_Init(void);
+
+// ************DMAControl_Remaining*****************
+// Number of items a control structure still has to move
+// Inputs:  index of the structure (DMA_PRI(ch) or DMA_ALT(ch))
+// Outputs: 0 if the structure is done (stopped), otherwise items left
+uint32_t DMAControl_Remaining(uint32_t index);
+
+#endif //  __DMACONTROL_H__
@@ -0,0 +1,57 @@
+// DisplayDev.h
+// Runs on TM4C123
+// One interface to the LCD drivers in this folder, so code that draws
+// (TM4C/Display.c, TM4C/Dashboard.c) works with whichever panel is wired.
+// Each adapter (ST7735Dev.c, SSD2119Dev.c, Nokia5110Dev.c, HD44780Dev.c,
+// AGM1264FDev.c) fills in a DisplayDev_t with the fastest primitive its
+// driver has for each operation: one rectangle, one bitmap, one string.
+// SSD2119, HD44780 and AGM1264F all define LCD_Init, LCD_OutChar, ...,
+// and ST7735 and Nokia5110 both define Output_Init, so link one driver
+// and its adapter per project.
+
+#ifndef _DISPLAYDEV_H_
+#define _DISPLAYDEV_H_
+#include <stdint.h>
+
+// flags
+#define DISPLAYDEV_COLOR    0x01  // colors are shown; else any nonzero color is "on"
+#define DISPLAYDEV_TEXTONLY 0x02  // text cells only: fill blanks the cells it touches, no blit
+#define DISPLAYDEV_BUFFERED 0x04  // drawing goes to RAM, flush sends it to the panel
+
+// Colors are 16-bit 5-6-5 as returned by ST7735_Color565 (ST7735.h).
+// Coordinates are pixels, (0,0) at the top left.  On a character LCD
+// (HD44780) a pixel is a character cell, charW = charH = 1.
+typedef struct{
+  const char *name;
+  uint16_t width, height;   // pixels
+  uint8_t charW, charH;     // pixels per text cell
+  uint8_t flags;            // DISPLAYDEV_...
+  void (*init)(void);       // initialize the panel and clear it to black
+  // Fill a rectangle with one color, clipped to the panel; w or h <= 0
+  // draws nothing.
+  void (*fill)(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  // Draw an image like ST7735_DrawBitmap: (x,y) is the bottom left corner,
+  // the array holds the bottom row first.  0 on a text-only panel.
+  void (*blit)(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
+  // Draw a null-terminated string in text cell (col,row) on black, clipped
+  // at the right edge.  Returns the number of characters drawn.
+  uint32_t (*text)(uint16_t col, uint16_t row, const char *pt, uint16_t color);
+  // Send what was drawn to the panel; 0 if drawing is immediate.
+  void (*flush)(void);
+  // Hardware vertical scrolling as ST7735_SetScrollArea and
+  // ST7735_SetScrollStart; 0 if the panel has none.
+  void (*scrollArea)(uint16_t top, uint16_t bottom);
+  void (*scrollStart)(uint16_t y);
+} DisplayDev_t;
+
+// text cells on the panel
+#define DisplayDev_Cols(dev) ((dev)->width/(dev)->charW)
+#define DisplayDev_Rows(dev) ((dev)->height/(dev)->charH)
+
+extern const DisplayDev_t ST7735_Dev;    // ST7735.c, 128x160 color
+extern const DisplayDev_t SSD2119_Dev;   // SSD2119.c, 320x240 color
+extern const DisplayDev_t Nokia5110_Dev; // Nokia5110.c, 84x48 mono, buffered
+extern const DisplayDev_t HD44780_Dev;   // HD44780.c, 16 characters
+extern const DisplayDev_t AGM1264F_Dev;  // AGM1264F.c, 21 by 8 characters
+
+#endif
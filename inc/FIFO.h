@@ -27,10 +27,67 @@
 
 #ifndef __FIFO_H__
 #define __FIFO_H__
+#include <stdint.h>
+#include <string.h>
 
 long StartCritical (void);    // previous I bit, disable interrupts
 void EndCritical(long sr);    // restore I bit to previous value
 
+// Define FIFO_STATS as 1 (project wide, or before including this file)
+// to have every FIFO made by the macros below keep a FifoStats_t named
+// NAMEFifoStats.  Fifo_Init registers it, and FifoStats_Print in
+// FIFOStats.c lists all of them.  With FIFO_STATS 0 there is no cost.
+#ifndef FIFO_STATS
+#define FIFO_STATS 0
+#endif
+
+typedef struct FifoStats{
+  const char *name;             // NAME given to the macro
+  uint32_t size;                // SIZE given to the macro
+  uint32_t volatile highWater;  // most elements ever stored at once
+  uint32_t volatile putFails;   // puts or put spans that found it full
+  uint32_t volatile total;      // elements put since the last clear
+  struct FifoStats *next;       // registry list
+} FifoStats_t;
+
+//------------FifoStats_Register------------
+// Add a FIFO to the registry, called by Fifo_Init when FIFO_STATS is 1
+// Registering the same FIFO twice has no effect
+// Input: pointer to its statistics
+// Output: none
+void FifoStats_Register(FifoStats_t *stats);
+
+//------------FifoStats_Print------------
+// Print one line per registered FIFO:
+//   name size high-water put-fails total
+// Input: function that outputs one character
+// Output: none
+void FifoStats_Print(void (*out)(char));
+
+//------------FifoStats_Clear------------
+// Zero the high-water marks and counters of all registered FIFOs
+// Input: none
+// Output: none
+void FifoStats_Clear(void);
+
+#if FIFO_STATS
+#define FIFO_STATS_DEF(NAME,SIZE) \
+FifoStats_t NAME ## FifoStats = {#NAME "Fifo", SIZE, 0, 0, 0, 0};
+#define FIFO_STATS_INIT(NAME) FifoStats_Register(&NAME ## FifoStats);
+#define FIFO_STATS_PUT(NAME,N,USED) {  \
+  NAME ## FifoStats.total += (N);      \
+  if((USED) > NAME ## FifoStats.highWater){ \
+    NAME ## FifoStats.highWater = (USED);   \
+  }                                    \
+}
+#define FIFO_STATS_FAIL(NAME) NAME ## FifoStats.putFails++;
+#else
+#define FIFO_STATS_DEF(NAME,SIZE)
+#define FIFO_STATS_INIT(NAME)
+#define FIFO_STATS_PUT(NAME,N,USED)
+#define FIFO_STATS_FAIL(NAME)
+#endif
+
 
 
 // macro to create an index FIFO
@@ -38,17 +95,21 @@ void EndCritical(long sr);    // restore I bit to previous value
 uint32_t volatile NAME ## PutI;    \
 uint32_t volatile NAME ## GetI;    \
 TYPE static NAME ## Fifo [SIZE];        \
+FIFO_STATS_DEF(NAME,SIZE)               \
 void NAME ## Fifo_Init(void){ long sr;  \
   sr = StartCritical();                 \
   NAME ## PutI = NAME ## GetI = 0;      \
+  FIFO_STATS_INIT(NAME)                 \
   EndCritical(sr);                      \
 }                                       \
 int NAME ## Fifo_Put (TYPE data){       \
   if(( NAME ## PutI - NAME ## GetI ) & ~(SIZE-1)){  \
+    FIFO_STATS_FAIL(NAME)  \
     return(FAIL);      \
   }                    \
   NAME ## Fifo[ NAME ## PutI &(SIZE-1)] = data; \
-  NAME ## PutI ## ++;  \
+  NAME ## PutI++;  \
+  FIFO_STATS_PUT(NAME, 1, NAME ## PutI - NAME ## GetI) \
   return(SUCCESS);     \
 }                      \
 int NAME ## Fifo_Get (TYPE *datapt){  \
@@ -56,25 +117,105 @@ int NAME ## Fifo_Get (TYPE *datapt){  \
     return(FAIL);      \
   }                    \
   *datapt = NAME ## Fifo[ NAME ## GetI &(SIZE-1)];  \
-  NAME ## GetI ## ++;  \
+  NAME ## GetI++;  \
   return(SUCCESS);     \
 }                      \
 unsigned short NAME ## Fifo_Size (void){  \
  return ((unsigned short)( NAME ## PutI - NAME ## GetI ));  \
+}                      \
+uint32_t NAME ## Fifo_PutSpan (TYPE **pt){  \
+  uint32_t put = NAME ## PutI;           \
+  uint32_t n = SIZE - (put - NAME ## GetI); \
+  if(n > SIZE - (put&(SIZE-1))){         \
+    n = SIZE - (put&(SIZE-1));           \
+  }                                      \
+  if(n == 0){                            \
+    FIFO_STATS_FAIL(NAME)                \
+  }                                      \
+  *pt = &NAME ## Fifo[put&(SIZE-1)];     \
+  return(n);                             \
+}                                        \
+void NAME ## Fifo_PutCommit (uint32_t n){ \
+  NAME ## PutI = NAME ## PutI + n;       \
+  FIFO_STATS_PUT(NAME, n, NAME ## PutI - NAME ## GetI) \
+}                                        \
+uint32_t NAME ## Fifo_GetSpan (TYPE **pt){  \
+  uint32_t get = NAME ## GetI;           \
+  uint32_t n = NAME ## PutI - get;       \
+  if(n > SIZE - (get&(SIZE-1))){         \
+    n = SIZE - (get&(SIZE-1));           \
+  }                                      \
+  *pt = &NAME ## Fifo[get&(SIZE-1)];     \
+  return(n);                             \
+}                                        \
+void NAME ## Fifo_GetCommit (uint32_t n){ \
+  NAME ## GetI = NAME ## GetI + n;       \
+}                                        \
+uint32_t NAME ## Fifo_GetView (TYPE **pt1, uint32_t *n1, TYPE **pt2, uint32_t *n2){ \
+  uint32_t get = NAME ## GetI;           \
+  uint32_t n = NAME ## PutI - get;       \
+  uint32_t first = SIZE - (get&(SIZE-1)); \
+  *pt1 = &NAME ## Fifo[get&(SIZE-1)];    \
+  *pt2 = &NAME ## Fifo[0];               \
+  if(n > first){                         \
+    *n1 = first;                         \
+    *n2 = n - first;                     \
+  } else{                                \
+    *n1 = n;                             \
+    *n2 = 0;                             \
+  }                                      \
+  return(n);                             \
+}                                        \
+uint32_t NAME ## Fifo_PutN (const TYPE *data, uint32_t n){ \
+  TYPE *pt; uint32_t span, done = 0;     \
+  while(done < n){                       \
+    span = NAME ## Fifo_PutSpan(&pt);    \
+    if(span == 0) break;                 \
+    if(span > n - done) span = n - done; \
+    memcpy(pt, &data[done], span*sizeof(TYPE)); \
+    NAME ## Fifo_PutCommit(span);        \
+    done += span;                        \
+  }                                      \
+  return(done);                          \
+}                                        \
+uint32_t NAME ## Fifo_GetN (TYPE *data, uint32_t n){ \
+  TYPE *pt; uint32_t span, done = 0;     \
+  while(done < n){                       \
+    span = NAME ## Fifo_GetSpan(&pt);    \
+    if(span == 0) break;                 \
+    if(span > n - done) span = n - done; \
+    memcpy(&data[done], pt, span*sizeof(TYPE)); \
+    NAME ## Fifo_GetCommit(span);        \
+    done += span;                        \
+  }                                      \
+  return(done);                          \
 }
 // e.g.,
 // AddIndexFifo(Tx,32,unsigned char, 1,0)
 // SIZE must be a power of two
 // creates TxFifo_Init() TxFifo_Get() and TxFifo_Put()
+// and the bulk functions TxFifo_PutN() TxFifo_GetN()
+// TxFifo_PutSpan() returns how many elements can be written in place
+// starting at *pt, TxFifo_PutCommit(n) then publishes the first n of them
+// TxFifo_GetSpan() and TxFifo_GetCommit(n) do the same for reading
+// TxFifo_GetView() returns everything stored as at most two runs, *pt1
+// for *n1 elements then *pt2 for *n2, so a parser can look at a whole
+// frame in place; TxFifo_GetCommit(n) then releases any n of them
+// A span never crosses the end of the array, so at most two spans cover
+// the whole FIFO.  Only the producer (Put*) writes PutI and only the
+// consumer (Get*) writes GetI, so one producer and one consumer need no
+// critical section, same as Put and Get.
 
 // macro to create a pointer FIFO
 #define AddPointerFifo(NAME,SIZE,TYPE,SUCCESS,FAIL) \
 TYPE volatile *NAME ## PutPt;    \
 TYPE volatile *NAME ## GetPt;    \
 TYPE static NAME ## Fifo [SIZE];        \
+FIFO_STATS_DEF(NAME,SIZE)               \
 void NAME ## Fifo_Init(void){ long sr;  \
   sr = StartCritical();                 \
   NAME ## PutPt = NAME ## GetPt = &NAME ## Fifo[0]; \
+  FIFO_STATS_INIT(NAME)                 \
   EndCritical(sr);                      \
 }                                       \
 int NAME ## Fifo_Put (TYPE data){       \
@@ -84,11 +225,13 @@ int NAME ## Fifo_Put (TYPE data){       \
     nextPutPt = &NAME ## Fifo[0];       \
   }                                     \
   if(nextPutPt == NAME ## GetPt ){      \
+    FIFO_STATS_FAIL(NAME)               \
     return(FAIL);                       \
   }                                     \
   else{                                 \
     *( NAME ## PutPt ) = data;          \
     NAME ## PutPt = nextPutPt;          \
+    FIFO_STATS_PUT(NAME, 1, (nextPutPt - NAME ## GetPt + SIZE)%SIZE) \
     return(SUCCESS);                    \
   }                                     \
 }                                       \
@@ -96,7 +239,7 @@ int NAME ## Fifo_Get (TYPE *datapt){    \
   if( NAME ## PutPt == NAME ## GetPt ){ \
     return(FAIL);                       \
   }                                     \
-  *datapt = *( NAME ## GetPt ## ++);    \
+  *datapt = *( NAME ## GetPt++);    \
   if( NAME ## GetPt == &NAME ## Fifo[SIZE]){ \
     NAME ## GetPt = &NAME ## Fifo[0];   \
   }                                     \
@@ -107,10 +250,91 @@ unsigned short NAME ## Fifo_Size (void){\
     return ((unsigned short)( NAME ## PutPt - NAME ## GetPt + (SIZE*sizeof(TYPE)))/sizeof(TYPE)); \
   }                                     \
   return ((unsigned short)( NAME ## PutPt - NAME ## GetPt )/sizeof(TYPE)); \
+}                                       \
+uint32_t NAME ## Fifo_PutSpan (TYPE **pt){ \
+  TYPE volatile *put = NAME ## PutPt;   \
+  TYPE volatile *get = NAME ## GetPt;   \
+  uint32_t n;                           \
+  *pt = (TYPE *)put;                    \
+  if(put < get){                        \
+    n = get - put - 1;                  \
+  } else if(get == &NAME ## Fifo[0]){   \
+    n = &NAME ## Fifo[SIZE] - put - 1;  \
+  } else{                               \
+    n = &NAME ## Fifo[SIZE] - put;      \
+  }                                     \
+  if(n == 0){                           \
+    FIFO_STATS_FAIL(NAME)               \
+  }                                     \
+  return(n);                            \
+}                                       \
+void NAME ## Fifo_PutCommit (uint32_t n){ \
+  TYPE volatile *put = NAME ## PutPt + n; \
+  if(put == &NAME ## Fifo[SIZE]){       \
+    put = &NAME ## Fifo[0];             \
+  }                                     \
+  NAME ## PutPt = put;                  \
+  FIFO_STATS_PUT(NAME, n, (put - NAME ## GetPt + SIZE)%SIZE) \
+}                                       \
+uint32_t NAME ## Fifo_GetSpan (TYPE **pt){ \
+  TYPE volatile *put = NAME ## PutPt;   \
+  TYPE volatile *get = NAME ## GetPt;   \
+  *pt = (TYPE *)get;                    \
+  if(get <= put){                       \
+    return(put - get);                  \
+  }                                     \
+  return(&NAME ## Fifo[SIZE] - get);    \
+}                                       \
+void NAME ## Fifo_GetCommit (uint32_t n){ \
+  TYPE volatile *get = NAME ## GetPt + n; \
+  if(get >= &NAME ## Fifo[SIZE]){       \
+    get = get - SIZE;                   \
+  }                                     \
+  NAME ## GetPt = get;                  \
+}                                       \
+uint32_t NAME ## Fifo_GetView (TYPE **pt1, uint32_t *n1, TYPE **pt2, uint32_t *n2){ \
+  TYPE volatile *put = NAME ## PutPt;   \
+  TYPE volatile *get = NAME ## GetPt;   \
+  *pt1 = (TYPE *)get;                   \
+  *pt2 = &NAME ## Fifo[0];              \
+  if(get <= put){                       \
+    *n1 = put - get;                    \
+    *n2 = 0;                            \
+  } else{                               \
+    *n1 = &NAME ## Fifo[SIZE] - get;    \
+    *n2 = put - &NAME ## Fifo[0];       \
+  }                                     \
+  return(*n1 + *n2);                    \
+}                                       \
+uint32_t NAME ## Fifo_PutN (const TYPE *data, uint32_t n){ \
+  TYPE *pt; uint32_t span, done = 0;    \
+  while(done < n){                      \
+    span = NAME ## Fifo_PutSpan(&pt);   \
+    if(span == 0) break;                \
+    if(span > n - done) span = n - done; \
+    memcpy(pt, &data[done], span*sizeof(TYPE)); \
+    NAME ## Fifo_PutCommit(span);       \
+    done += span;                       \
+  }                                     \
+  return(done);                         \
+}                                       \
+uint32_t NAME ## Fifo_GetN (TYPE *data, uint32_t n){ \
+  TYPE *pt; uint32_t span, done = 0;    \
+  while(done < n){                      \
+    span = NAME ## Fifo_GetSpan(&pt);   \
+    if(span == 0) break;                \
+    if(span > n - done) span = n - done; \
+    memcpy(&data[done], pt, span*sizeof(TYPE)); \
+    NAME ## Fifo_GetCommit(span);       \
+    done += span;                       \
+  }                                     \
+  return(done);                         \
 }
 // e.g.,
 // AddPointerFifo(Rx,32,unsigned char, 1,0)
 // SIZE can be any size
 // creates RxFifo_Init() RxFifo_Get() and RxFifo_Put()
+// and the same bulk, span and view functions as AddIndexFifo
+// One slot is always left empty, so a put span stops one short of GetPt
 
 #endif //  __FIFO_H__
@@ -0,0 +1,86 @@
+// FIFOStats.c
+// Runs on any Cortex microcontroller
+// Registry for the statistics kept by the FIFOs of FIFO.h when FIFO_STATS
+// is 1.  Each FIFO registers itself in its Fifo_Init, so the firmware can
+// print the high-water mark, put failures and throughput of all of them
+// without knowing their names.
+// The list is only changed by Fifo_Init (with interrupts disabled), and
+// only read here, so printing from main while the ISRs run is safe.
+
+#include <stdint.h>
+#include "../inc/FIFO.h"
+
+static FifoStats_t *FifoStatsList = 0;
+
+//------------FifoStats_Register------------
+// Add a FIFO to the registry, called by Fifo_Init when FIFO_STATS is 1
+// Registering the same FIFO twice has no effect
+// Input: pointer to its statistics
+// Output: none
+void FifoStats_Register(FifoStats_t *stats){ long sr;
+  FifoStats_t *pt;
+  sr = StartCritical();
+  for(pt = FifoStatsList; pt; pt = pt->next){
+    if(pt == stats){
+      EndCritical(sr);
+      return;                         // already listed
+    }
+  }
+  stats->next = FifoStatsList;
+  FifoStatsList = stats;
+  EndCritical(sr);
+}
+
+// private function used to print a string
+static void outString(void (*out)(char), const char *pt){
+  while(*pt){
+    out(*pt);
+    pt++;
+  }
+}
+
+// private function used to print an unsigned decimal number
+static void outUDec(void (*out)(char), uint32_t n){
+  char buf[10];
+  int i = 0;
+  do{
+    buf[i++] = '0' + n%10;
+    n = n/10;
+  } while(n);
+  while(i){
+    out(buf[--i]);
+  }
+}
+
+//------------FifoStats_Print------------
+// Print one line per registered FIFO:
+//   name size high-water put-fails total
+// Input: function that outputs one character
+// Output: none
+void FifoStats_Print(void (*out)(char)){
+  FifoStats_t *pt;
+  outString(out, "fifo size max fails total\r\n");
+  for(pt = FifoStatsList; pt; pt = pt->next){
+    outString(out, pt->name);    out(' ');
+    outUDec(out, pt->size);      out(' ');
+    outUDec(out, pt->highWater); out(' ');
+    outUDec(out, pt->putFails);  out(' ');
+    outUDec(out, pt->total);
+    outString(out, "\r\n");
+  }
+}
+
+//------------FifoStats_Clear------------
+// Zero the high-water marks and counters of all registered FIFOs
+// Input: none
+// Output: none
+void FifoStats_Clear(void){ long sr;
+  FifoStats_t *pt;
+  sr = StartCritical();
+  for(pt = FifoStatsList; pt; pt = pt->next){
+    pt->highWater = 0;
+    pt->putFails = 0;
+    pt->total = 0;
+  }
+  EndCritical(sr);
+}
@@ -122,6 +122,15 @@ void LCD_Clear(void){
   SysTick_Wait(T1600us); // wait 1.6ms
 }
 
+// Move the cursor
+// Inputs: column 0 to 15 (display address 00 to 0F)
+// Outputs: none
+// ignores illegal addresses
+void LCD_GoTo(uint32_t column){
+  if(column>15) return;
+  OutCmd(0x80+column);  // Set DD RAM address
+}
+
 //------------LCD_OutString------------
 // Output String (NULL termination)
 // Input: pointer to a NULL-terminated string to be transferred
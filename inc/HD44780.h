@@ -57,6 +57,12 @@ void LCD_OutChar(char letter);
 // Outputs: none
 void LCD_Clear(void);
 
+// Move the cursor
+// Inputs: column 0 to 15 (display address 00 to 0F)
+// Outputs: none
+// ignores illegal addresses
+void LCD_GoTo(uint32_t column);
+
 //------------LCD_OutString------------
 // Output String (NULL termination)
 // Input: pointer to a NULL-terminated string to be transferred
@@ -0,0 +1,50 @@
+// HD44780Dev.c
+// Runs on TM4C123
+// DisplayDev_t adapter for the HD44780 16-character LCD (HD44780.c).
+// A character LCD has no pixels: width and height count characters,
+// fill writes spaces over the cells and there is no blit.
+
+#include <stdint.h>
+#include "DisplayDev.h"
+#include "HD44780.h"
+
+#define HD44780_COLS 16
+
+static void hd44780Init(void){
+  LCD_Init();
+  LCD_Clear();
+}
+
+static void hd44780Fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  if((y > 0) || (y + h <= 0)) return;  // one row
+  if(x < 0){ w = w + x; x = 0;}
+  if(x + w > HD44780_COLS) w = HD44780_COLS - x;
+  if(w <= 0) return;
+  LCD_GoTo(x);
+  while(w){
+    LCD_OutChar(' ');
+    w--;
+  }
+}
+
+static uint32_t hd44780Text(uint16_t col, uint16_t row, const char *pt, uint16_t color){
+  uint32_t count = 0;
+  if((row > 0) || (col >= HD44780_COLS)) return 0;
+  LCD_GoTo(col);
+  while(*pt && (col + count < HD44780_COLS)){
+    LCD_OutChar(*pt);
+    pt++;
+    count++;
+  }
+  return count;
+}
+
+const DisplayDev_t HD44780_Dev = {
+  "HD44780", HD44780_COLS, 1, 1, 1, DISPLAYDEV_TEXTONLY,
+  hd44780Init,
+  hd44780Fill,
+  0,                                 // no pixels
+  hd44780Text,
+  0,                                 // draws immediately
+  0, 0                               // no hardware scrolling
+};
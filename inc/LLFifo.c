@@ -1,6 +1,9 @@
 // LLFifo.c
 // Runs on any computer
-// linked list FIFO
+// linked list FIFO of variable-sized messages, see LLFifo.h
+// The nodes come from a Pool instead of a heap of one fixed type.
+// Linking and unlinking run with interrupts disabled, so messages can be
+// put by an ISR and taken by main (or the other way around).
 // Jonathan Valvano
 // May 14, 2012
 
@@ -21,54 +24,130 @@
  http://users.ece.utexas.edu/~valvano/
  */
 #include <stdint.h>
-#include "../inc/HeapBlock.h"
+#include <string.h>
+#include "../inc/CortexM.h"
+#include "../inc/LLFifo.h"
 
-#define NULL 0  // definition of empty pointer
-
- struct Node{
-  struct Node *Next;
-  int32_t Data;
-};
-
-typedef struct Node NodeType;
-NodeType *PutPt;   // place to put
-NodeType *GetPt;   // place to get
-
-void Fifo_Init(void){
-  GetPt = NULL;    // Empty when null
-  PutPt = NULL;
-  Heap_Init();
+//------------LLFifo_Init------------
+// Make an empty queue that takes its blocks from a pool
+// Input: queue, and an initialized pool (which may be shared)
+// Output: none
+void LLFifo_Init(LLFifo_t *fifo, Pool_t *pool){
+  fifo->GetPt = 0;    // Empty when null
+  fifo->PutPt = 0;
+  fifo->Pool = pool;
+  fifo->Count = 0;
 }
 
-int Fifo_Put(int32_t theData){
-NodeType *pt;
-  pt = (NodeType*)Heap_Allocate();
-  if(!pt){         // check for NULL pointer if heap full
+//------------LLFifo_Reserve------------
+// Take a block for a message of size bytes, to be filled in place
+// Input: queue, size of the message in bytes
+// Output: pointer to the data area, or 0 if there is no room
+void *LLFifo_Reserve(LLFifo_t *fifo, uint32_t size){
+LLNode_t *pt;
+  if(size > LLFIFO_MAXDATA(fifo->Pool)){
+    return(0);     // too big for one block
+  }
+  pt = (LLNode_t *)Pool_Allocate(fifo->Pool);
+  if(!pt){         // check for NULL pointer if pool empty
     return(0);     // full
   }
-  pt->Data = theData; // store
-  pt->Next = NULL;
-  if(PutPt){
-    PutPt->Next = pt; // Link
+  pt->Next = 0;
+  pt->Size = size;
+  return(pt+1);    // data follows the header
+}
+
+//------------LLFifo_Commit------------
+// Append a message obtained with LLFifo_Reserve
+// Input: queue, pointer returned by LLFifo_Reserve
+// Output: none
+void LLFifo_Commit(LLFifo_t *fifo, void *data){ long sr;
+LLNode_t *pt = (LLNode_t *)data - 1;
+  sr = StartCritical();
+  if(fifo->PutPt){
+    fifo->PutPt->Next = pt; // Link
   }
   else{
-    GetPt = pt;    // first one
+    fifo->GetPt = pt;    // first one
   }
-  PutPt = pt;
+  fifo->PutPt = pt;
+  fifo->Count++;
+  EndCritical(sr);
+}
+
+//------------LLFifo_Put------------
+// Copy a message into the queue
+// Input: queue, data and its size in bytes
+// Output: 1 for success, 0 if there is no room
+int LLFifo_Put(LLFifo_t *fifo, const void *data, uint32_t size){
+void *pt = LLFifo_Reserve(fifo, size);
+  if(!pt){
+    return(0);     // full
+  }
+  memcpy(pt, data, size); // store
+  LLFifo_Commit(fifo, pt);
   return(1);       // successful
 }
 
-int Fifo_Get(int32_t *datapt){
-NodeType *pt;
-  if(!GetPt){      // check for NULL pointer if FIFO empty
+//------------LLFifo_Peek------------
+// Look at the oldest message in place, without removing it
+// Input: queue, where to store its size (may be null)
+// Output: pointer to its data, or 0 if the queue is empty
+void *LLFifo_Peek(LLFifo_t *fifo, uint32_t *size){
+LLNode_t *pt = fifo->GetPt;
+  if(!pt){         // check for NULL pointer if FIFO empty
     return(0);     // empty
   }
-  *datapt = GetPt->Data;
-  pt = GetPt;
-  GetPt = GetPt->Next;
-  if(GetPt==NULL){ // one entry
-    PutPt = NULL;
+  if(size){
+    *size = pt->Size;
   }
-  Heap_Release((int32_t*)pt);
+  return(pt+1);
+}
+
+//------------LLFifo_Release------------
+// Remove the oldest message and give its block back to the pool
+// Input: queue
+// Output: none
+void LLFifo_Release(LLFifo_t *fifo){ long sr;
+LLNode_t *pt;
+  sr = StartCritical();
+  pt = fifo->GetPt;
+  if(pt){
+    fifo->GetPt = pt->Next;
+    if(fifo->GetPt == 0){ // was the only entry
+      fifo->PutPt = 0;
+    }
+    fifo->Count--;
+  }
+  EndCritical(sr);
+  if(pt){
+    Pool_Release(fifo->Pool, pt);
+  }
+}
+
+//------------LLFifo_Get------------
+// Copy out and remove the oldest message
+// Input: queue, where to copy it, *size is the room there in bytes
+// Output: 1 and *size set to the bytes copied, 0 if the queue is empty
+int LLFifo_Get(LLFifo_t *fifo, void *data, uint32_t *size){
+uint32_t n;
+void *pt = LLFifo_Peek(fifo, &n);
+  if(!pt){
+    return(0);     // empty
+  }
+  if(n > *size){
+    n = *size;     // cut to the room given
+  }
+  memcpy(data, pt, n);
+  *size = n;
+  LLFifo_Release(fifo);
   return(1);       // success
 }
+
+//------------LLFifo_Size------------
+// Number of messages in the queue
+// Input: queue
+// Output: messages
+uint32_t LLFifo_Size(LLFifo_t *fifo){
+  return fifo->Count;
+}
@@ -1,6 +1,9 @@
 // LLFifo.h
 // Runs on any computer
-// linked list FIFO
+// linked list FIFO of variable-sized messages
+// Each message lives in one block taken from a Pool (see Pool.h), so
+// any number of queues can share one pool and one memory budget, and a
+// message can be built and read in place (Reserve/Commit, Peek/Release)
 // Jonathan Valvano
 // May 14, 2012
 
@@ -21,8 +24,78 @@
  http://users.ece.utexas.edu/~valvano/
  */
 
-void Fifo_Init(void);
+#ifndef __LLFIFO_H__
+#define __LLFIFO_H__
+#include <stdint.h>
+#include "../inc/Pool.h"
 
-int Fifo_Put(int32_t theData);
+// header in front of every message, the data follows it in the block
+typedef struct LLNode{
+  struct LLNode *Next;          // next message, null at the tail
+  uint32_t Size;                // data bytes
+} LLNode_t;
 
-int Fifo_Get(int32_t *datapt);
+typedef struct LLFifo{
+  LLNode_t *GetPt;              // oldest message, null if empty
+  LLNode_t *PutPt;              // newest message
+  Pool_t *Pool;                 // where the blocks come from
+  uint32_t volatile Count;      // messages in the queue
+} LLFifo_t;
+
+// largest message a pool can hold
+#define LLFIFO_MAXDATA(POOL) ((POOL)->blockSize - sizeof(LLNode_t))
+// block size to give AddPool for messages of up to SIZE bytes
+#define LLFIFO_BLOCK(SIZE) ((SIZE) + sizeof(LLNode_t))
+
+//------------LLFifo_Init------------
+// Make an empty queue that takes its blocks from a pool
+// Input: queue, and an initialized pool (which may be shared)
+// Output: none
+void LLFifo_Init(LLFifo_t *fifo, Pool_t *pool);
+
+//------------LLFifo_Reserve------------
+// Take a block for a message of size bytes, to be filled in place
+// The message is not in the queue until LLFifo_Commit
+// Input: queue, size of the message in bytes
+// Output: pointer to the data area, or 0 if the pool is empty or the
+//         message does not fit in a block
+void *LLFifo_Reserve(LLFifo_t *fifo, uint32_t size);
+
+//------------LLFifo_Commit------------
+// Append a message obtained with LLFifo_Reserve
+// Input: queue, pointer returned by LLFifo_Reserve
+// Output: none
+void LLFifo_Commit(LLFifo_t *fifo, void *data);
+
+//------------LLFifo_Put------------
+// Copy a message into the queue
+// Input: queue, data and its size in bytes
+// Output: 1 for success, 0 if the pool is empty or it does not fit
+int LLFifo_Put(LLFifo_t *fifo, const void *data, uint32_t size);
+
+//------------LLFifo_Peek------------
+// Look at the oldest message in place, without removing it
+// Input: queue, where to store its size (may be null)
+// Output: pointer to its data, or 0 if the queue is empty
+void *LLFifo_Peek(LLFifo_t *fifo, uint32_t *size);
+
+//------------LLFifo_Release------------
+// Remove the oldest message and give its block back to the pool
+// Input: queue
+// Output: none
+void LLFifo_Release(LLFifo_t *fifo);
+
+//------------LLFifo_Get------------
+// Copy out and remove the oldest message
+// Input: queue, where to copy it, *size is the room there in bytes
+// Output: 1 and *size set to the bytes copied (the message is cut to
+//         the room given), 0 if the queue is empty
+int LLFifo_Get(LLFifo_t *fifo, void *data, uint32_t *size);
+
+//------------LLFifo_Size------------
+// Number of messages in the queue
+// Input: queue
+// Output: messages
+uint32_t LLFifo_Size(LLFifo_t *fifo);
+
+#endif //  __LLFIFO_H__
@@ -440,6 +440,28 @@ void Nokia5110_ClrPxl(unsigned long i, unsigned long j){
 void Nokia5110_SetPxl(unsigned long i, unsigned long j){
   Screen[84*(i>>3) + j] |= Masks[i&0x07];
 }
+//********Nokia5110_BufferChar*****************
+// Put a character into the screen buffer at a text position,
+// the same cell Nokia5110_OutChar would use after
+// Nokia5110_SetCursor(newX, newY).  Nokia5110_DisplayBuffer
+// shows it.
+// inputs: newX  X-position of the character (0<=newX<=11)
+//         newY  Y-position of the character (0<=newY<=5)
+//         data  character to print
+// outputs: none
+void Nokia5110_BufferChar(unsigned char newX, unsigned char newY, unsigned char data){
+  uint8_t *pt;
+  int i;
+  if((newX > 11) || (newY > 5) || (data < 0x20) || (data > 0x7F)){
+    return;                        // bad input
+  }
+  pt = &Screen[SCREENW*newY + 7*newX];
+  *pt++ = 0x00;                    // blank vertical line padding
+  for(i=0; i<5; i=i+1){
+    *pt++ = ASCII[data - 0x20][i];
+  }
+  *pt = 0x00;                      // blank vertical line padding
+}
 uint32_t NokiaLineNumber;
 // Print a character to Nokia LCD.
 int fputc(int ch, FILE *f){
@@ -282,6 +282,17 @@ void Nokia5110_ClearBuffer(void);
 // assumes: LCD is in default horizontal addressing mode (V = 0)
 void Nokia5110_DisplayBuffer(void);
 
+//********Nokia5110_BufferChar*****************
+// Put a character into the screen buffer at a text position,
+// the same cell Nokia5110_OutChar would use after
+// Nokia5110_SetCursor(newX, newY).  Nokia5110_DisplayBuffer
+// shows it.
+// inputs: newX  X-position of the character (0<=newX<=11)
+//         newY  Y-position of the character (0<=newY<=5)
+//         data  character to print
+// outputs: none
+void Nokia5110_BufferChar(unsigned char newX, unsigned char newY, unsigned char data);
+
 //------------Nokia5110_ClrPxl------------
 // Clear the Image pixel at (i, j), turning it dark.
 // Input: i  the row index  (0 to 47 in this case),    y-coordinate
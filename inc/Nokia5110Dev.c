@@ -0,0 +1,83 @@
+// Nokia5110Dev.c
+// Runs on TM4C123
+// DisplayDev_t adapter for the Nokia 5110 84x48 monochrome LCD
+// (Nokia5110.c).  Everything is drawn into the driver's RAM screen
+// buffer; flush sends the 504-byte buffer only if something changed
+// since the last flush.  Any nonzero color turns pixels on.  Text uses
+// the driver's 7x8 cells, 12 by 6.
+
+#include <stdint.h>
+#include "DisplayDev.h"
+#include "Nokia5110.h"
+
+static uint32_t Changed;             // buffer differs from the panel
+
+static void nokiaInit(void){
+  Nokia5110_Init();
+  Nokia5110_ClearBuffer();
+  Nokia5110_DisplayBuffer();
+  Changed = 0;
+}
+
+static void nokiaFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  int16_t i, j;
+  if(x < 0){ w = w + x; x = 0;}
+  if(y < 0){ h = h + y; y = 0;}
+  if(x + w > SCREENW) w = SCREENW - x;
+  if(y + h > SCREENH) h = SCREENH - y;
+  for(i = y; i < y + h; i++){
+    for(j = x; j < x + w; j++){
+      if(color){
+        Nokia5110_SetPxl(i, j);
+      } else{
+        Nokia5110_ClrPxl(i, j);
+      }
+    }
+  }
+  Changed = 1;
+}
+
+static void nokiaBlit(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h){
+  int16_t r, c;
+  for(r = 0; r < h; r++){            // bottom row first
+    if((y - r < 0) || (y - r >= SCREENH)) continue;
+    for(c = 0; c < w; c++){
+      if((x + c < 0) || (x + c >= SCREENW)) continue;
+      if(image[r*w + c]){
+        Nokia5110_SetPxl(y - r, x + c);
+      } else{
+        Nokia5110_ClrPxl(y - r, x + c);
+      }
+    }
+  }
+  Changed = 1;
+}
+
+static uint32_t nokiaText(uint16_t col, uint16_t row, const char *pt, uint16_t color){
+  uint32_t count = 0;
+  if(row > 5) return 0;
+  while(*pt && (col + count < 12)){
+    Nokia5110_BufferChar(col + count, row, *pt);
+    pt++;
+    count++;
+  }
+  Changed = 1;
+  return count;
+}
+
+static void nokiaFlush(void){
+  if(Changed){
+    Nokia5110_DisplayBuffer();
+    Changed = 0;
+  }
+}
+
+const DisplayDev_t Nokia5110_Dev = {
+  "Nokia5110", SCREENW, SCREENH, 7, 8, DISPLAYDEV_BUFFERED,
+  nokiaInit,
+  nokiaFill,
+  nokiaBlit,
+  nokiaText,
+  nokiaFlush,
+  0, 0                               // no hardware scrolling
+};
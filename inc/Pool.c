@@ -0,0 +1,77 @@
+// Pool.c
+// Runs on any computer
+// Fixed-size block allocator, see Pool.h
+// The free list is changed with interrupts disabled, so a block can be
+// allocated in an ISR and released in main (or the other way around).
+
+#include <stdint.h>
+#include "../inc/CortexM.h"
+#include "../inc/Pool.h"
+
+//------------Pool_Init------------
+// Cut a memory area into blocks and put all of them on the free list
+// Input: pool to initialize
+//        mem is the memory, at least POOL_BLOCK(size)*count bytes
+//        size is the block size in bytes
+//        count is the number of blocks
+// Output: none
+void Pool_Init(Pool_t *pool, void *mem, uint32_t size, uint32_t count){ long sr;
+  uint8_t *block = (uint8_t *)mem;
+  uint32_t i;
+  size = POOL_BLOCK(size);
+  sr = StartCritical();
+  pool->freeList = 0;
+  for(i = count; i; i--){               // link last to first, so the list
+    void **pt = (void **)&block[(i-1)*size]; // hands out blocks in address order
+    *pt = pool->freeList;
+    pool->freeList = pt;
+  }
+  pool->blockSize = size;
+  pool->count = count;
+  pool->freeCount = count;
+  pool->minFree = count;
+  pool->fails = 0;
+  EndCritical(sr);
+}
+
+//------------Pool_Allocate------------
+// Take one block from the pool
+// Input: pool
+// Output: pointer to the block, or 0 (null) if the pool is empty
+void *Pool_Allocate(Pool_t *pool){ long sr;
+  void **pt;
+  sr = StartCritical();
+  pt = (void **)pool->freeList;
+  if(pt){
+    pool->freeList = *pt;               // unlink the first free block
+    pool->freeCount--;
+    if(pool->freeCount < pool->minFree){
+      pool->minFree = pool->freeCount;
+    }
+  } else{
+    pool->fails++;
+  }
+  EndCritical(sr);
+  return pt;
+}
+
+//------------Pool_Release------------
+// Give a block back to the pool it came from
+// Input: pool and a block returned by Pool_Allocate
+// Output: none
+void Pool_Release(Pool_t *pool, void *block){ long sr;
+  void **pt = (void **)block;
+  sr = StartCritical();
+  *pt = pool->freeList;                 // push it on the free list
+  pool->freeList = pt;
+  pool->freeCount++;
+  EndCritical(sr);
+}
+
+//------------Pool_Free------------
+// Number of blocks that can be allocated now
+// Input: pool
+// Output: free blocks
+uint32_t Pool_Free(Pool_t *pool){
+  return pool->freeCount;
+}
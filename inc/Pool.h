@@ -0,0 +1,67 @@
+// Pool.h
+// Runs on any computer
+// Fixed-size block allocator.  A pool is a static array cut into equal
+// blocks; the free blocks are kept in a singly linked list threaded
+// through the blocks themselves, so allocate and release are a couple
+// of pointer moves and never fail in any way other than "pool empty".
+// Several queues (see LLFifo.h) can draw from one pool, so BGAPI events,
+// display commands and the like share one memory budget.
+// Allocate and release run with interrupts disabled for a few
+// instructions, so both can be called from main and from ISRs.
+
+#ifndef __POOL_H__
+#define __POOL_H__
+#include <stdint.h>
+
+typedef struct Pool{
+  void * volatile freeList;     // first free block, each links to the next
+  uint32_t blockSize;           // bytes per block, rounded up to a pointer
+  uint32_t count;               // blocks in the pool
+  uint32_t volatile freeCount;  // blocks free now
+  uint32_t volatile minFree;    // fewest blocks ever free (low-water mark)
+  uint32_t volatile fails;      // allocations that found the pool empty
+} Pool_t;
+
+// bytes a block of SIZE really uses, enough for the free list link
+#define POOL_BLOCK(SIZE) ((((SIZE)+sizeof(void *)-1)/sizeof(void *))*sizeof(void *))
+
+// macro to create a pool of COUNT blocks of SIZE bytes
+#define AddPool(NAME,SIZE,COUNT) \
+static void *NAME ## PoolMem[(POOL_BLOCK(SIZE)/sizeof(void *))*(COUNT)]; \
+Pool_t NAME ## Pool;                    \
+void NAME ## Pool_Init(void){           \
+  Pool_Init(&NAME ## Pool, NAME ## PoolMem, SIZE, COUNT); \
+}
+// e.g.,
+// AddPool(Msg,40,64)
+// creates MsgPool, 64 blocks of 40 bytes, and MsgPool_Init()
+// blocks are aligned to a pointer (4 bytes on the TM4C123)
+
+//------------Pool_Init------------
+// Cut a memory area into blocks and put all of them on the free list
+// Input: pool to initialize
+//        mem is the memory, at least POOL_BLOCK(size)*count bytes
+//        size is the block size in bytes
+//        count is the number of blocks
+// Output: none
+void Pool_Init(Pool_t *pool, void *mem, uint32_t size, uint32_t count);
+
+//------------Pool_Allocate------------
+// Take one block from the pool
+// Input: pool
+// Output: pointer to the block, or 0 (null) if the pool is empty
+void *Pool_Allocate(Pool_t *pool);
+
+//------------Pool_Release------------
+// Give a block back to the pool it came from
+// Input: pool and a block returned by Pool_Allocate
+// Output: none
+void Pool_Release(Pool_t *pool, void *block);
+
+//------------Pool_Free------------
+// Number of blocks that can be allocated now
+// Input: pool
+// Output: free blocks
+uint32_t Pool_Free(Pool_t *pool);
+
+#endif //  __POOL_H__
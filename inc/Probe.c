@@ -0,0 +1,211 @@
+// Probe.c
+// Runs on TM4C123
+// Latency probes timed with the DWT cycle counter, see Probe.h.
+// Probe_End runs in the context of the probe (often an ISR), so it only
+// adds to the probe's own counters; the registry list is changed with
+// interrupts disabled, once per probe, and only read here otherwise.
+
+#include <stdint.h>
+#include "../inc/tm4c123gh6pm.h"
+#include "../inc/CortexM.h"
+#include "../inc/Profile.h"
+#include "../inc/Probe.h"
+
+#if defined(__CC_ARM)
+#define CLZ(x) __clz(x)
+#else
+#define CLZ(x) __builtin_clz(x)
+#endif
+
+static Probe_t *ProbeList = 0;
+
+// Profile pin n is bit Pins[n].bit of the port with clock gate Pins[n].port
+#define PORTC 0x04
+#define PORTE 0x10
+#define PORTF 0x20
+static const struct{ uint8_t port; uint8_t bit; } Pins[7] = {
+  {PORTE, PROFILE0_BIT}, {PORTE, PROFILE1_BIT}, {PORTE, PROFILE2_BIT},
+  {PORTF, PROFILE3_BIT}, {PORTE, PROFILE4_BIT}, {PORTC, PROFILE5_BIT},
+  {PORTC, PROFILE6_BIT}
+};
+
+// PCTL mask of the 4-bit fields of the pins in bits
+static uint32_t pctlMask(uint32_t bits){
+  uint32_t mask = 0;
+  int i;
+  for(i = 0; i < 8; i++){
+    if(bits&(1u<<i)){
+      mask |= 0xFu<<(4*i);
+    }
+  }
+  return mask;
+}
+
+//------------Probe_Init------------
+// Start the DWT cycle counter and make the given Profile pins outputs
+// (only those, so pins that other drivers use, e.g. PC5 for UART1, stay
+// theirs).  Call once before any probe begins.
+// Input: bit n set to use Profile pin n (Profile.h), 0 for none
+// Output: none
+void Probe_Init(uint32_t pins){
+  uint32_t c = 0, e = 0, f = 0;
+  int n;
+  DEMCR |= DEMCR_TRCENA;           // enable the DWT
+  DWTCYCCNT = 0;
+  DWTCTRL |= DWTCTRL_CYCCNTENA;    // start counting CPU cycles
+  for(n = 0; n < 7; n++){
+    if(pins&(1u<<n)){
+      if(Pins[n].port == PORTC) c |= Pins[n].bit;
+      if(Pins[n].port == PORTE) e |= Pins[n].bit;
+      if(Pins[n].port == PORTF) f |= Pins[n].bit;
+    }
+  }
+  if(c){                           // same steps as Profile_Init
+    SYSCTL_RCGCGPIO_R |= PORTC;
+    while((SYSCTL_PRGPIO_R&PORTC) == 0){};
+    GPIO_PORTC_AMSEL_R &= ~c;
+    GPIO_PORTC_PCTL_R &= ~pctlMask(c);
+    GPIO_PORTC_DIR_R |= c;
+    GPIO_PORTC_AFSEL_R &= ~c;
+    GPIO_PORTC_PUR_R &= ~c;
+    GPIO_PORTC_PDR_R &= ~c;
+    GPIO_PORTC_DEN_R |= c;
+    GPIO_PORTC_DATA_R &= ~c;
+  }
+  if(e){
+    SYSCTL_RCGCGPIO_R |= PORTE;
+    while((SYSCTL_PRGPIO_R&PORTE) == 0){};
+    GPIO_PORTE_AMSEL_R &= ~e;
+    GPIO_PORTE_PCTL_R &= ~pctlMask(e);
+    GPIO_PORTE_DIR_R |= e;
+    GPIO_PORTE_AFSEL_R &= ~e;
+    GPIO_PORTE_PUR_R &= ~e;
+    GPIO_PORTE_PDR_R &= ~e;
+    GPIO_PORTE_DEN_R |= e;
+    GPIO_PORTE_DATA_R &= ~e;
+  }
+  if(f){
+    SYSCTL_RCGCGPIO_R |= PORTF;
+    while((SYSCTL_PRGPIO_R&PORTF) == 0){};
+    GPIO_PORTF_AMSEL_R &= ~f;
+    GPIO_PORTF_PCTL_R &= ~pctlMask(f);
+    GPIO_PORTF_DIR_R |= f;
+    GPIO_PORTF_AFSEL_R &= ~f;
+    GPIO_PORTF_PUR_R &= ~f;
+    GPIO_PORTF_PDR_R &= ~f;
+    GPIO_PORTF_DEN_R |= f;
+    GPIO_PORTF_DATA_R &= ~f;
+  }
+}
+
+// private function to add a probe to the list the first time it ends
+static void registerProbe(Probe_t *probe){ long sr;
+  sr = StartCritical();
+  if(probe->listed == 0){
+    probe->listed = 1;
+    probe->next = ProbeList;
+    ProbeList = probe;
+  }
+  EndCritical(sr);
+}
+
+//------------Probe_End------------
+// Account for one interval, called by PROBE_END
+// Input: probe, CYCCNT when it began
+// Output: none
+void Probe_End(Probe_t *probe, uint32_t start){
+  uint32_t cycles = DWTCYCCNT - start;  // modulo 2^32, 53 s at 80 MHz
+  uint32_t k;
+  if(probe->pin){
+    *probe->pin = 0;
+  }
+  k = 31 - CLZ(cycles|1);               // floor(log2(cycles))
+  if(k >= PROBE_BUCKETS){
+    k = PROBE_BUCKETS - 1;
+  }
+  probe->bucket[k]++;
+  probe->count++;
+  if(cycles > probe->max){
+    probe->max = cycles;
+  }
+  if(probe->listed == 0){
+    registerProbe(probe);
+  }
+}
+
+// private function used to print a string
+static void outString(void (*out)(char), const char *pt){
+  while(*pt){
+    out(*pt);
+    pt++;
+  }
+}
+
+// private function used to print an unsigned decimal number
+static void outUDec(void (*out)(char), uint32_t n){
+  char buf[10];
+  int i = 0;
+  do{
+    buf[i++] = '0' + n%10;
+    n = n/10;
+  } while(n);
+  while(i){
+    out(buf[--i]);
+  }
+}
+
+//------------Probe_Print------------
+// Print one line per registered probe:
+//   name count max, then cycles:count for each nonzero bucket (cycles
+//   is the bucket's lower bound)
+// Each probe is copied with interrupts disabled for a moment and printed
+// from the copy, so the system keeps running (and measuring) meanwhile.
+// Input: function that outputs one character, CPU clock in Hz (printed
+//        in the heading, to turn cycles into time)
+// Output: none
+void Probe_Print(void (*out)(char), uint32_t freq){ long sr;
+  Probe_t *pt;
+  uint32_t count, max, bucket[PROBE_BUCKETS];
+  int k;
+  outString(out, "probe count max cycles:count (");
+  outUDec(out, freq);
+  outString(out, " cycles/s)\r\n");
+  for(pt = ProbeList; pt; pt = pt->next){
+    sr = StartCritical();
+    count = pt->count;
+    max = pt->max;
+    for(k = 0; k < PROBE_BUCKETS; k++){
+      bucket[k] = pt->bucket[k];
+    }
+    EndCritical(sr);
+    outString(out, pt->name); out(' ');
+    outUDec(out, count);      out(' ');
+    outUDec(out, max);
+    for(k = 0; k < PROBE_BUCKETS; k++){
+      if(bucket[k]){
+        out(' ');
+        outUDec(out, 1u<<k);  out(':');
+        outUDec(out, bucket[k]);
+      }
+    }
+    outString(out, "\r\n");
+  }
+}
+
+//------------Probe_Clear------------
+// Zero the counters and histograms of all registered probes
+// Input: none
+// Output: none
+void Probe_Clear(void){ long sr;
+  Probe_t *pt;
+  int k;
+  sr = StartCritical();
+  for(pt = ProbeList; pt; pt = pt->next){
+    pt->count = 0;
+    pt->max = 0;
+    for(k = 0; k < PROBE_BUCKETS; k++){
+      pt->bucket[k] = 0;
+    }
+  }
+  EndCritical(sr);
+}
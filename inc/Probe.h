@@ -0,0 +1,95 @@
+// Probe.h
+// Runs on TM4C123
+// Latency probes: named pairs of points in the code whose distance in
+// CPU cycles is measured with the Cortex-M4 DWT cycle counter (CYCCNT)
+// and kept as a histogram with one bucket per power of 2.  A probe can
+// also drive one of the Profile.h pins high between its two points, so
+// a logic analyzer shows the same intervals.
+//   PROBE_DEF(UartIsrProbe, "uart1 isr", PROBE_NOPIN)   // file scope
+//   ...
+//   PROBE_BEGIN(UartIsrProbe);
+//   ... code measured ...
+//   PROBE_END(UartIsrProbe);
+// A probe registers itself the first time it ends, and Probe_Print
+// lists all of them, like FifoStats_Print for FIFO.h.  PROBE_DEF makes a
+// static variable, so names only have to be unique within one file.  Each probe is for
+// one context (one ISR, or main); its counters are not protected against
+// the same probe ending in a nested interrupt.
+// Define PROBE_ENABLE as 1 (project wide) to measure.  With
+// PROBE_ENABLE 0 the macros are empty and there is no cost.
+
+#ifndef __PROBE_H__
+#define __PROBE_H__
+#include <stdint.h>
+#include "../inc/CortexM.h"
+#include "../inc/Profile.h"
+
+#ifndef PROBE_ENABLE
+#define PROBE_ENABLE 0
+#endif
+
+#define PROBE_BUCKETS 24   // bucket k counts 2^k to 2^(k+1)-1 cycles,
+                           // the last one everything from 2^23 (0.1 s)
+
+typedef struct Probe{
+  const char *name;
+  volatile uint32_t *pin;       // Profile pin data register, 0 for none
+  uint32_t pinBit;
+  uint32_t volatile count;      // intervals measured since the last clear
+  uint32_t volatile max;        // longest, in cycles
+  uint32_t volatile bucket[PROBE_BUCKETS];
+  struct Probe *next;           // registry list
+  uint32_t listed;              // 1 once registered
+} Probe_t;
+
+// pin argument of PROBE_DEF: Profile pin 0 to 6, or none
+#define PROBE_PIN(N) &PROFILE ## N, PROFILE ## N ## _BIT
+#define PROBE_NOPIN  0, 0
+
+// a macro's value as a string, for names: "uart" PROBE_STR(UART_NUM)
+#define PROBE_STR(X) PROBE_STR2(X)
+#define PROBE_STR2(X) #X
+
+//------------Probe_Init------------
+// Start the DWT cycle counter and make the given Profile pins outputs
+// (only those, so pins that other drivers use, e.g. PC5 for UART1, stay
+// theirs).  Call once before any probe begins.
+// Input: bit n set to use Profile pin n (Profile.h), 0 for none
+// Output: none
+void Probe_Init(uint32_t pins);
+
+//------------Probe_End------------
+// Account for one interval, called by PROBE_END
+// Input: probe, CYCCNT when it began
+// Output: none
+void Probe_End(Probe_t *probe, uint32_t start);
+
+//------------Probe_Print------------
+// Print one line per registered probe:
+//   name count max, then cycles:count for each nonzero bucket (cycles
+//   is the bucket's lower bound)
+// Each probe is copied with interrupts disabled for a moment and printed
+// from the copy, so the system keeps running (and measuring) meanwhile.
+// Input: function that outputs one character, CPU clock in Hz (printed
+//        in the heading, to turn cycles into time)
+// Output: none
+void Probe_Print(void (*out)(char), uint32_t freq);
+
+//------------Probe_Clear------------
+// Zero the counters and histograms of all registered probes
+// Input: none
+// Output: none
+void Probe_Clear(void);
+
+#if PROBE_ENABLE
+#define PROBE_DEF(VAR,NAME,PIN) static Probe_t VAR = {NAME, PIN};
+#define PROBE_BEGIN(VAR) uint32_t VAR ## Start = \
+  ((VAR).pin? (*(VAR).pin = (VAR).pinBit): 0, DWTCYCCNT)
+#define PROBE_END(VAR) Probe_End(&(VAR), VAR ## Start)
+#else
+#define PROBE_DEF(VAR,NAME,PIN)
+#define PROBE_BEGIN(VAR)
+#define PROBE_END(VAR)
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+// SSD2119Dev.c
+// Runs on TM4C123
+// DisplayDev_t adapter for the SSD2119 320x240 color LCD (SSD2119.c).
+// The SSD2119 orders 5-6-5 colors red first, ST7735_Color565 blue first,
+// so colors are swapped on the way in.  Fill is LCD_DrawFilledRect (one
+// address per row); blit sets the address once per row and streams the
+// row; text uses the driver's 6x9 character cells, 53 by 26.
+
+#include <stdint.h>
+#include "DisplayDev.h"
+#include "SSD2119.h"
+
+#define SSD2119_WIDTH   320
+#define SSD2119_HEIGHT  240
+#define SSD2119_COLS    53               // MAX_CHARS_X in SSD2119.c
+#define SSD2119_ROWS    26               // MAX_CHARS_Y
+#define SSD2119_X_RAM_ADDR_REG  0x4E     // as SSD2119.c
+#define SSD2119_Y_RAM_ADDR_REG  0x4F
+#define SSD2119_RAM_DATA_REG    0x22
+
+// ST7735_Color565 order (blue in bits 15-11) to SSD2119 order (red)
+static uint16_t swapColor(uint16_t color){
+  return ((color&0x1F)<<11) | (color&0x07E0) | (color>>11);
+}
+
+static void ssd2119Init(void){
+  LCD_Init();
+  LCD_ColorFill(0);
+}
+
+static void ssd2119Fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  if(x < 0){ w = w + x; x = 0;}
+  if(y < 0){ h = h + y; y = 0;}
+  if(x + w > SSD2119_WIDTH)  w = SSD2119_WIDTH - x;
+  if(y + h > SSD2119_HEIGHT) h = SSD2119_HEIGHT - y;
+  if((w <= 0) || (h <= 0)) return;
+  LCD_DrawFilledRect(x, y, w, h, swapColor(color));
+}
+
+static void ssd2119Blit(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h){
+  int16_t r, c, left, right;
+  left = (x < 0)? -x: 0;             // visible columns of the image
+  right = (x + w > SSD2119_WIDTH)? SSD2119_WIDTH - x: w;
+  if(left >= right) return;
+  for(r = 0; r < h; r++){            // bottom row first
+    if((y - r < 0) || (y - r >= SSD2119_HEIGHT)) continue;
+    LCD_WriteCommand(SSD2119_X_RAM_ADDR_REG);
+    LCD_WriteData(x + left);
+    LCD_WriteCommand(SSD2119_Y_RAM_ADDR_REG);
+    LCD_WriteData(y - r);
+    LCD_WriteCommand(SSD2119_RAM_DATA_REG);
+    for(c = left; c < right; c++){
+      LCD_WriteData(swapColor(image[r*w + c]));
+    }
+  }
+}
+
+static uint32_t ssd2119Text(uint16_t col, uint16_t row, const char *pt, uint16_t color){
+  uint32_t count = 0;
+  if((col >= SSD2119_COLS) || (row >= SSD2119_ROWS)) return 0;
+  LCD_Goto(col, row);
+  LCD_SetTextColor((color&0x1F)<<3, ((color>>5)&0x3F)<<2, (color>>11)<<3);
+  while(*pt && (col + count < SSD2119_COLS)){
+    LCD_PrintChar(*pt);                // black background
+    pt++;
+    count++;
+  }
+  return count;
+}
+
+const DisplayDev_t SSD2119_Dev = {
+  "SSD2119", SSD2119_WIDTH, SSD2119_HEIGHT, 6, 9, DISPLAYDEV_COLOR,
+  ssd2119Init,
+  ssd2119Fill,
+  ssd2119Blit,
+  ssd2119Text,
+  0,                                 // draws immediately
+  0, 0                               // no hardware scrolling
+};
@@ -116,6 +116,18 @@
 #include "ST7735.h"
 #include "../inc/tm4c123gh6pm.h"
 
+// Set ST7735_DMA to 1 (project wide) to stream ST7735_FillRect and
+// ST7735_DrawBitmap to SSI0 with uDMA channel 11.  The functions then
+// return as soon as the transfer is started; the next ST7735 call waits
+// for it, and ST7735_SetDMACallback names a function run when it ends.
+// This driver then owns SSI0_Handler.  Needs DMAControl.c.
+#ifndef ST7735_DMA
+#define ST7735_DMA 0
+#endif
+#if ST7735_DMA
+#include "../inc/DMAControl.h"
+#endif
+
 // 16 rows (0 to 15) and 21 characters (0 to 20)
 // Requires (11 + size*size*6*8) bytes of transmission for each character
 uint32_t StX=0; // position along the horizonal axis 0 to 20
@@ -142,6 +154,8 @@ uint16_t StTextColor = ST7735_YELLOW;
 #define ST7735_RAMRD   0x2E
 
 #define ST7735_PTLAR   0x30
+#define ST7735_VSCRDEF 0x33
+#define ST7735_VSCSAD  0x37
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
 
@@ -220,6 +234,8 @@ uint16_t StTextColor = ST7735_YELLOW;
 #define ST7735_RAMRD   0x2E
 
 #define ST7735_PTLAR   0x30
+#define ST7735_VSCRDEF 0x33
+#define ST7735_VSCSAD  0x37
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
 
@@ -531,7 +547,14 @@ static int16_t _height = ST7735_TFTHEIGHT;
 // and then adds the data to the transmit FIFO.
 // NOTE: These functions will crash or stall indefinitely if
 // the SSI0 module is not initialized and enabled.
+#if ST7735_DMA
+static void dmaWait(void);
+static void dmaInit(void);
+#endif
 void static writecommand(uint8_t c) {
+#if ST7735_DMA
+  dmaWait();                            // a stream owns SSI0 until it ends
+#endif
                                         // wait until SSI0 not busy/transmit FIFO empty
   while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
   TFT_CS = TFT_CS_LOW;
@@ -783,6 +806,9 @@ void static commonInit(const uint8_t *cmdList) {
   SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+SSI_CR0_DSS_8;
   SSI0_CR1_R |= SSI_CR1_SSE;            // enable SSI
 
+#if ST7735_DMA
+  dmaInit();
+#endif
   if(cmdList) commandList(cmdList);
 }
 
@@ -856,6 +882,196 @@ void static pushColor(uint16_t color) {
   writedata((uint8_t)color);
 }
 
+#if ST7735_DMA
+// uDMA pixel streaming
+// During a stream SSI0 sends 16-bit frames, so a uint16_t pixel goes out
+// most significant byte first, the same order as pushColor.  A stream is
+// rows runs of width pixels; a run longer than 1024 pixels (fills) is
+// sent as several structures, and each next run or structure is started
+// from SSI0_Handler when the previous one completes.
+#define DMA_SSI0TX     11                 // SSI0 TX, channel 11 encoding 0
+#define SSI0TXBIT      (1u<<DMA_SSI0TX)
+#define CHSSI0TX       DMA_PRI(DMA_SSI0TX)
+#define ST7735_DMA_MIN 32                 // smaller areas are written by the CPU
+#define SSI_CR0_DSS_16 0x0000000F         // 16-bit data
+
+static const uint16_t *DmaRow;            // first pixel of the current run
+static const uint16_t *DmaPt;             // next pixel to hand to uDMA
+static uint32_t DmaLeft;                  // pixels of the run not yet handed over
+static uint32_t DmaRows;                  // runs still to go after this one
+static uint32_t DmaWidth;                 // pixels per run
+static int32_t DmaStride;                 // pixels from one run to the next
+static uint32_t DmaSrcInc;                // DMA_SRCINC_16, or DMA_SRCINC_NONE for fills
+static uint16_t DmaColor;                 // source of fills
+static uint32_t volatile DmaBusy;
+static void (*DmaDone)(void);
+static uint32_t (*DmaRefill)(void);       // starts more of the stream, 0 if none
+
+// private function used to set SSI0 frame size, SSI0 must be idle
+static void ssiFrameSize(uint32_t dss){
+  SSI0_CR1_R &= ~SSI_CR1_SSE;             // disable SSI
+  SSI0_CR0_R = (SSI0_CR0_R&~SSI_CR0_DSS_M)+dss;
+  SSI0_CR1_R |= SSI_CR1_SSE;              // enable SSI
+}
+
+// private function used to hand the next piece of the run to uDMA
+static void dmaNext(void){
+  uint32_t count = DmaLeft;
+  if(count > DMA_MAXITEMS){
+    count = DMA_MAXITEMS;
+  }
+  if(DmaSrcInc == DMA_SRCINC_NONE){
+    ucControlTable[CHSSI0TX] = (uint32_t)DmaPt;            // fixed source
+  } else{
+    ucControlTable[CHSSI0TX] = (uint32_t)(DmaPt+count-1);  // last address
+    DmaPt += count;
+  }
+  ucControlTable[CHSSI0TX+1] = (uint32_t)&SSI0_DR_R;       // fixed destination
+  ucControlTable[CHSSI0TX+2] = DMA_DSTINC_NONE|DMA_DSTSIZE_16|DmaSrcInc|DMA_SRCSIZE_16|
+                               DMA_ARB_4|DMA_XFERSIZE(count)|DMA_MODE_BASIC;
+  DmaLeft -= count;
+  UDMA_ENASET_R = SSI0TXBIT;              // bit clears when done
+}
+
+// private function used to start a stream after setAddrWindow
+static void dmaStream(const uint16_t *src, uint32_t srcInc, uint32_t rows,
+                      uint32_t width, int32_t stride){
+  while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
+  DC = DC_DATA;
+  ssiFrameSize(SSI_CR0_DSS_16);
+  DmaRow = DmaPt = src;
+  DmaSrcInc = srcInc;
+  DmaRows = rows - 1;
+  DmaWidth = DmaLeft = width;
+  DmaStride = stride;
+  DmaBusy = 1;
+  SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;
+  dmaNext();
+}
+
+// wait for the stream to finish, called before SSI0 is used otherwise
+static void dmaWait(void){
+  while(DmaBusy){};
+}
+
+// private function used by Init to route SSI0 TX requests to uDMA
+static void dmaInit(void){
+  DMAControl_Init();
+  UDMA_CHMAP1_R = (UDMA_CHMAP1_R&~0x0000F000); // channel 11 encoding 0 is SSI0 TX
+  UDMA_PRIOCLR_R = SSI0TXBIT;             // default, not high priority
+  UDMA_ALTCLR_R = SSI0TXBIT;              // use primary control
+  UDMA_USEBURSTCLR_R = SSI0TXBIT;         // responds to both burst and single requests
+  UDMA_REQMASKCLR_R = SSI0TXBIT;          // allow the uDMA controller to recognize requests
+  DmaBusy = 0;
+  NVIC_PRI1_R = (NVIC_PRI1_R&0x00FFFFFF)|0x60000000; // SSI0 is IRQ 7, priority 3
+  NVIC_EN0_R = 1<<7;                      // enable interrupt 7 in NVIC
+}
+
+// uDMA has finished a structure on channel 11
+void SSI0_Handler(void){
+  if(UDMA_CHIS_R&SSI0TXBIT){
+    UDMA_CHIS_R = SSI0TXBIT;              // acknowledge
+    if(DmaLeft){
+      dmaNext();                          // rest of a long run
+    } else if(DmaRows){
+      DmaRows--;
+      DmaRow += DmaStride;                // next row of the image
+      DmaPt = DmaRow;
+      DmaLeft = DmaWidth;
+      dmaNext();
+    } else if(DmaRefill && DmaRefill()){
+                                          // next span of an RLE image
+    } else{
+      DmaRefill = 0;
+      SSI0_DMACTL_R &= ~SSI_DMACTL_TXDMAE;
+      // at most 8 frames left in the TX FIFO, 16 us at 8 MHz
+      while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
+      ssiFrameSize(SSI_CR0_DSS_8);
+      TFT_CS = TFT_CS_HIGH;
+      DmaBusy = 0;
+      if(DmaDone){
+        DmaDone();
+      }
+    }
+  }
+}
+
+//------------ST7735_SetDMACallback------------
+// Name a function to run (from SSI0_Handler) each time a uDMA
+// FillRect or DrawBitmap has been completely sent
+// Input: task, or 0 for none
+// Output: none
+void ST7735_SetDMACallback(void (*task)(void)){
+  DmaDone = task;
+}
+
+//------------ST7735_DMABusy------------
+// Check if a uDMA FillRect or DrawBitmap is still being sent
+// While it is, a DrawBitmap image in RAM must not be changed
+// Input: none
+// Output: nonzero while busy
+uint32_t ST7735_DMABusy(void){
+  return DmaBusy;
+}
+#endif
+
+
+// Send n pixels from a buffer, most significant byte of each first
+// Requires 2*n bytes of transmission
+void static pushPixels(const uint16_t *pt, uint32_t n) {
+  DC = DC_DATA;
+  while(n){
+    while((SSI0_SR_R&SSI_SR_TNF)==0){};   // wait until transmit FIFO not full
+    SSI0_DR_R = (uint8_t)(*pt >> 8);
+    while((SSI0_SR_R&SSI_SR_TNF)==0){};
+    SSI0_DR_R = (uint8_t)*pt;
+    pt++;
+    n--;
+  }
+}
+
+// Glyph cache: characters drawn at size 1 are expanded once into the
+// 6x8 pixels they send, for a given text and background color, and the
+// next time the same character in the same colors is a straight copy
+// (or a uDMA stream).  Direct mapped on the character code, 100 bytes
+// per entry.  Set ST7735_GLYPHCACHE (project wide) to change the number
+// of entries; 1 keeps only the last glyph.
+#ifndef ST7735_GLYPHCACHE
+#define ST7735_GLYPHCACHE 8
+#endif
+#define GLYPHPIXELS (6*8)
+typedef struct{
+  uint16_t pixel[GLYPHPIXELS];            // rows top to bottom, 6 wide
+  uint16_t textColor, bgColor;
+  char c;
+  uint8_t valid;
+} Glyph_t;
+static Glyph_t GlyphCache[ST7735_GLYPHCACHE];
+
+// private function used to get the expanded pixels of a size 1 glyph
+// with uDMA the caller must first wait for the previous stream, which
+// may still be reading the entry (setAddrWindow does)
+static const uint16_t *glyphGet(char c, uint16_t textColor, uint16_t bgColor){
+  Glyph_t *g = &GlyphCache[(uint8_t)c%ST7735_GLYPHCACHE];
+  const uint8_t *font = &Font[(uint8_t)c*5];
+  uint16_t *pt;
+  int32_t row, col;
+  if(g->valid && (g->c == c) && (g->textColor == textColor) && (g->bgColor == bgColor)){
+    return g->pixel;                      // hit
+  }
+  pt = g->pixel;
+  for(row=0; row<8; row=row+1){
+    for(col=0; col<5; col=col+1){
+      *pt++ = ((font[col]>>row)&0x01)? textColor: bgColor;
+    }
+    *pt++ = bgColor;                      // blank column right of the character
+  }
+  g->c = c;
+  g->textColor = textColor;
+  g->bgColor = bgColor;
+  g->valid = 1;
+  return g->pixel;
+}
 
 //------------ST7735_DrawPixel------------
 // Color the pixel at the given coordinates with the given color.
@@ -963,6 +1179,13 @@ void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 
   setAddrWindow(x, y, x+w-1, y+h-1);
 
+#if ST7735_DMA
+  if(w*h >= ST7735_DMA_MIN){
+    DmaColor = color;                   // one pixel, sent w*h times
+    dmaStream(&DmaColor, DMA_SRCINC_NONE, 1, w*h, 0);
+    return;                             // SSI0_Handler deselects
+  }
+#endif
   for(y=h; y>0; y--) {
     for(x=w; x>0; x--) {
       writedata(hi);
@@ -1114,6 +1337,12 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, i
 
   setAddrWindow(x, y-h+1, x+w-1, y);
 
+#if ST7735_DMA
+  if(w*h >= ST7735_DMA_MIN){            // one run per row, bottom row of the image first
+    dmaStream(&image[i], DMA_SRCINC_16, h, w, skipC - 2*originalWidth + w);
+    return;                             // SSI0_Handler deselects
+  }
+#endif
   for(y=0; y<h; y=y+1){
     for(x=0; x<w; x=x+1){
                                         // send the top 8 bits
@@ -1130,6 +1359,198 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, i
 }
 
 
+// Run-length decoding for ST7735_DrawBitmapRLE
+// A code byte with bit 7 set repeats the palette index that follows it
+// (code&0x7F)+1 times; otherwise code+1 palette indices follow.  The
+// decoder hands out spans: a long repeat (merged with the repeats of the
+// same index after it) is sent as a fill, everything else is expanded
+// into up to RLE_CHUNK pixels.
+#define RLE_CHUNK   64                    // pixels per expanded span
+#define RLE_FILLMIN 16                    // shorter repeats are expanded
+
+typedef struct{
+  const uint8_t *pt;                      // at the current code's data
+  const uint16_t *palette;
+  uint32_t left;                          // pixels of the image still to come
+  uint32_t run;                           // pixels left in the current code
+  uint8_t repeat;                         // current code is a repeat
+} RleCursor_t;
+static RleCursor_t Rle;
+
+// private function used to decode the next span of the image
+// Output: pixels in the span, 0 at the end of the image
+//         *fill set if the span is n times *color, else the pixels are in buf
+static uint32_t rleSpan(uint16_t *buf, uint16_t *color, uint32_t *fill){
+  uint32_t n = 0, k, count;
+  const uint8_t *next;
+  uint16_t pixel;
+  *fill = 0;
+  while(Rle.left && (n < RLE_CHUNK)){
+    if(Rle.run == 0){
+      Rle.repeat = *Rle.pt&0x80;
+      Rle.run = (*Rle.pt&0x7F) + 1;
+      Rle.pt++;
+    }
+    k = RLE_CHUNK - n;
+    if(k > Rle.run) k = Rle.run;
+    if(k > Rle.left) k = Rle.left;
+    if(Rle.repeat){
+      count = Rle.run;                    // length with the repeats that continue it
+      next = Rle.pt + 1;
+      while((count < Rle.left) && (next[0]&0x80) && (next[1] == Rle.pt[0])){
+        count = count + (next[0]&0x7F) + 1;
+        next = next + 2;
+      }
+      if(count >= RLE_FILLMIN){
+        if(n){
+          return n;                       // send what is buffered first
+        }
+        if(count > Rle.left) count = Rle.left;
+        *color = Rle.palette[Rle.pt[0]];
+        *fill = 1;
+        Rle.pt = next;
+        Rle.run = 0;
+        Rle.left -= count;
+        return count;
+      }
+      pixel = Rle.palette[Rle.pt[0]];
+      Rle.run -= k;
+      Rle.left -= k;
+      if(Rle.run == 0){
+        Rle.pt++;                         // past the index
+      }
+      while(k){
+        buf[n++] = pixel;
+        k--;
+      }
+    } else{
+      Rle.run -= k;
+      Rle.left -= k;
+      while(k){
+        buf[n++] = Rle.palette[*Rle.pt++];
+        k--;
+      }
+    }
+  }
+  return n;
+}
+
+#if ST7735_DMA
+// with uDMA, spans are decoded into two slots: while one is being sent
+// from, the next is decoded into the other (from SSI0_Handler)
+static uint16_t RleBuf[2][RLE_CHUNK];
+static uint16_t RleColor[2];
+static const uint16_t *RleSrc[2];
+static uint32_t RleLen[2], RleInc[2];
+static uint32_t RleSlot;                  // slot being sent
+
+// private function used to decode the next span into slot k
+static void rleDecode(uint32_t k){
+  uint32_t fill;
+  RleLen[k] = rleSpan(RleBuf[k], &RleColor[k], &fill);
+  if(fill){
+    RleSrc[k] = &RleColor[k];
+    RleInc[k] = DMA_SRCINC_NONE;
+  } else{
+    RleSrc[k] = RleBuf[k];
+    RleInc[k] = DMA_SRCINC_16;
+  }
+}
+
+// DmaRefill of an RLE stream, start the decoded slot and decode the next
+static uint32_t rleRefill(void){
+  uint32_t k = RleSlot^1;
+  if(RleLen[k] == 0){
+    return 0;                             // end of the image
+  }
+  RleSlot = k;
+  DmaRow = DmaPt = RleSrc[k];
+  DmaSrcInc = RleInc[k];
+  DmaWidth = DmaLeft = RleLen[k];
+  DmaRows = 0;
+  dmaNext();
+  rleDecode(k^1);
+  return 1;
+}
+#endif
+
+//------------ST7735_DrawBitmapRLE------------
+// Displays a run-length encoded image made by tools/rle_convert.py.
+// Runs go to SSI0 as they are decoded: long runs of one color are sent
+// as fills (uDMA from one halfword when ST7735_DMA is set) and the rest
+// is expanded a few pixels at a time, so there is no full-size buffer.
+// Unlike ST7735_DrawBitmap the image may hang over any edge; a clipped
+// image is decoded in full and only its visible pixels are sent (by the
+// CPU).  A uDMA draw decodes from SSI0_Handler, so the image, palette
+// and data must stay valid until ST7735_DMABusy returns 0.
+// Requires (11 + 2*visible pixels) bytes of transmission
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        image pointer to the encoded image
+// Output: none
+void ST7735_DrawBitmapRLE(int16_t x, int16_t y, const ST7735_RLEImage_t *image){
+  int32_t w = image->width, h = image->height;
+  int32_t left = x, right = x + w - 1, top = y - h + 1, bottom = y;
+  int32_t col = 0, row = 0;
+  uint16_t buf[RLE_CHUNK], color;
+  uint32_t n, k, fill;
+
+  if(left < 0) left = 0;
+  if(right >= _width) right = _width - 1;
+  if(top < 0) top = 0;
+  if(bottom >= _height) bottom = _height - 1;
+  if((left > right) || (top > bottom)){
+    return;                               // image is totally off the screen
+  }
+  setAddrWindow(left, top, right, bottom);
+  Rle.pt = image->data;
+  Rle.palette = image->palette;
+  Rle.left = w*h;
+  Rle.run = 0;
+
+  if((left == x) && (right == x + w - 1) && (top == y - h + 1) && (bottom == y)){
+#if ST7735_DMA
+    if(w*h >= ST7735_DMA_MIN){
+      rleDecode(0);
+      rleDecode(1);
+      RleSlot = 0;
+      DmaRefill = &rleRefill;
+      dmaStream(RleSrc[0], RleInc[0], 1, RleLen[0], 0);
+      return;                             // SSI0_Handler deselects
+    }
+#endif
+    while((n = rleSpan(buf, &color, &fill))){
+      if(fill){
+        while(n){
+          pushColor(color);
+          n--;
+        }
+      } else{
+        pushPixels(buf, n);
+      }
+    }
+  } else{                                 // clipped, only send what is visible
+    top = top - (y - h + 1);              // visible rows and columns of the image
+    bottom = bottom - (y - h + 1);
+    left = left - x;
+    right = right - x;
+    while((row <= bottom) && (n = rleSpan(buf, &color, &fill))){
+      for(k=0; k<n; k=k+1){
+        if((row >= top) && (row <= bottom) && (col >= left) && (col <= right)){
+          pushColor(fill? color: buf[k]);
+        }
+        col = col + 1;
+        if(col == w){
+          col = 0;
+          row = row + 1;
+        }
+      }
+    }
+  }
+
+  deselect();
+}
+
 //------------ST7735_DrawCharS------------
 // Simple character draw function.  This is the same function from
 // Adafruit_GFX.c but adapted for this processor.  However, each call
@@ -1137,7 +1558,10 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, i
 // many extra data and commands.  If the background color is the same
 // as the text color, no background will be printed, and text can be
 // drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Otherwise a character that is fully on the screen is passed to
+// ST7735_DrawChar, which sets the window once.
+// Requires (11 + size*size*6*8) bytes of transmission (image fully on screen; textcolor != bgColor)
+// Requires (11 + 2*size*size) bytes per set pixel (textcolor == bgColor)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
 //        c         character to be printed
@@ -1153,6 +1577,12 @@ void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
      ((x + 6 * size - 1) < 0) || // Clip left
      ((y + 8 * size - 1) < 0))   // Clip top
     return;
+  if((bgColor != textColor) && (x >= 0) && (y >= 0) &&
+     ((x + 6*size) <= _width) && ((y + 8*size) <= _height)){
+    // opaque and fully on the screen: one window, one burst
+    ST7735_DrawChar(x, y, c, textColor, bgColor, size);
+    return;
+  }
 
   for (i=0; i<6; i++ ) {
     if (i == 5)
@@ -1183,7 +1613,9 @@ void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
 // Advanced character draw function.  This is similar to the function
 // from Adafruit_GFX.c but adapted for this processor.  However, this
 // function only uses one call to setAddrWindow(), which allows it to
-// run at least twice as fast.
+// run at least twice as fast.  Size 1 glyphs are kept expanded for the
+// colors used (see ST7735_GLYPHCACHE), and sent in one burst (one uDMA
+// stream with ST7735_DMA 1).
 // Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
@@ -1195,6 +1627,10 @@ void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
 void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size){
   uint8_t line; // horizontal row of pixels of character
   int32_t col, row, i, j;// loop indices
+  const uint8_t *font = &Font[(uint8_t)c*5];
+  const uint16_t *glyph;
+  uint16_t rowPixels[ST7735_TFTHEIGHT]; // one expanded row, 6*size pixels
+  uint16_t *pt;
   if(((x + 6*size - 1) >= _width)  || // Clip right
      ((y + 8*size - 1) >= _height) || // Clip bottom
      ((x + 6*size - 1) < 0)        || // Clip left
@@ -1204,29 +1640,31 @@ void ST7735_DrawChar(int16_t x, int16_t y, char c, int16_t textColor, int16_t bg
 
   setAddrWindow(x, y, x+6*size-1, y+8*size-1);
 
+  if(size == 1){
+    glyph = glyphGet(c, textColor, bgColor);
+#if ST7735_DMA
+    dmaStream(glyph, DMA_SRCINC_16, 1, GLYPHPIXELS, 0);
+    return;                             // SSI0_Handler deselects
+#else
+    pushPixels(glyph, GLYPHPIXELS);
+    deselect();
+    return;
+#endif
+  }
   line = 0x01;        // print the top row first
   // print the rows, starting at the top
   for(row=0; row<8; row=row+1){
-    for(i=0; i<size; i=i+1){
-      // print the columns, starting on the left
-      for(col=0; col<5; col=col+1){
-        if(Font[(c*5)+col]&line){
-          // bit is set in Font, print pixel(s) in text color
-          for(j=0; j<size; j=j+1){
-            pushColor(textColor);
-          }
-        } else{
-          // bit is cleared in Font, print pixel(s) in background color
-          for(j=0; j<size; j=j+1){
-            pushColor(bgColor);
-          }
-        }
-      }
-      // print blank column(s) to the right of character
+    // expand the row once, then send it size times
+    pt = rowPixels;
+    for(col=0; col<6; col=col+1){
+      uint16_t color = ((col < 5) && (font[col]&line))? textColor: bgColor;
       for(j=0; j<size; j=j+1){
-        pushColor(bgColor);
+        *pt++ = color;
       }
     }
+    for(i=0; i<size; i=i+1){
+      pushPixels(rowPixels, 6*size);
+    }
     line = line<<1;   // move up to the next row
   }
 
@@ -1466,6 +1904,63 @@ void ST7735_InvertDisplay(int i) {
   }  
   deselect();
 }
+
+
+//------------ST7735_SetScrollArea------------
+// Define the vertical scrolling area (VSCRDEF).  Rows above top and
+// the last bottom rows stay put; the rows between them wrap around as
+// ST7735_SetScrollStart moves them.  Drawing still uses the unscrolled
+// frame memory coordinates.  Meant for rotations 0 and 2, where the
+// 160-pixel side is vertical.
+// Requires 7 bytes of transmission
+// Input: top    number of fixed rows at the top (0 for none)
+//        bottom number of fixed rows at the bottom (0 for none)
+// Output: none
+static uint16_t ScrollTop, ScrollArea;  // as given, in screen rows
+void ST7735_SetScrollArea(uint16_t top, uint16_t bottom){
+  uint16_t tfa, bfa;
+  ScrollTop = top;
+  ScrollArea = ST7735_TFTHEIGHT - top - bottom;
+  // the panel scans frame memory from its own first row; with MY set
+  // (rotation 0) that row is the bottom of the screen, so the fixed
+  // areas swap.  The green tab has one hidden row at each end.
+  if(Rotation < 2){
+    tfa = bottom + RowStart;
+    bfa = top + RowStart;
+  } else{
+    tfa = top + RowStart;
+    bfa = bottom + RowStart;
+  }
+  writecommand(ST7735_VSCRDEF);
+  writedata(tfa >> 8);
+  writedata(tfa);                     // TFA
+  writedata(ScrollArea >> 8);
+  writedata(ScrollArea);              // VSA
+  writedata(bfa >> 8);
+  writedata(bfa);                     // BFA
+  deselect();
+}
+
+//------------ST7735_SetScrollStart------------
+// Pick the row shown first (at the top) of the scrolling area
+// (VSCSAD).  Scrolling one text line is one call, no pixels are sent.
+// Requires 3 bytes of transmission
+// Input: y row, from top to 159-bottom as given to ST7735_SetScrollArea
+//          (y=top shows the area unscrolled)
+// Output: none
+void ST7735_SetScrollStart(uint16_t y){
+  uint16_t ssa, offset = (y - ScrollTop)%ScrollArea;
+  if(Rotation < 2){                   // memory runs bottom to top
+    ssa = (ST7735_TFTHEIGHT - ScrollTop - ScrollArea) + RowStart +
+          (ScrollArea - offset)%ScrollArea;
+  } else{
+    ssa = ScrollTop + RowStart + offset;
+  }
+  writecommand(ST7735_VSCSAD);
+  writedata(ssa >> 8);
+  writedata(ssa);
+  deselect();
+}
 // graphics routines
 // y coordinates 0 to 31 used for labels and messages
 // y coordinates 32 to 159  128 pixels high
@@ -260,6 +260,47 @@ uint16_t ST7735_SwapColor(uint16_t x) ;
 // Must be less than or equal to 128 pixels wide by 160 pixels high
 void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
 
+// Run-length encoded image for ST7735_DrawBitmapRLE, as written by
+//   python3 tools/rle_convert.py image.bmp Name > Name.c
+// Pixels are palette indices, top row first, left to right, coded in
+// runs: a byte with bit 7 set repeats the index after it (byte&0x7F)+1
+// times, any other byte is followed by byte+1 indices.
+typedef struct{
+  uint16_t width, height;      // pixels
+  uint16_t colors;             // palette entries, 1 to 256
+  const uint16_t *palette;     // colors in ST7735_Color565 format
+  const uint8_t *data;         // runs
+} ST7735_RLEImage_t;
+
+//------------ST7735_DrawBitmapRLE------------
+// Displays a run-length encoded image.  Runs of one color are sent as
+// fills and the rest is expanded on the fly, so flash holds about one
+// byte per run instead of two per pixel, and large areas of one color
+// draw without reading any pixels.  The image may hang over the edges
+// of the screen; only the visible part is sent.
+// (x,y) is the screen location of the lower left corner of the image
+// Requires (11 + 2*w*h) bytes of transmission (image fully on screen)
+// Input: x     horizontal position of the bottom left corner of the image, columns from the left edge
+//        y     vertical position of the bottom left corner of the image, rows from the top edge
+//        image pointer to the encoded image
+// Output: none
+void ST7735_DrawBitmapRLE(int16_t x, int16_t y, const ST7735_RLEImage_t *image);
+
+//------------ST7735_SetDMACallback------------
+// Name a function to run (from SSI0_Handler) each time a uDMA
+// FillRect or DrawBitmap has been completely sent (ST7735_DMA 1 only)
+// Input: task, or 0 for none
+// Output: none
+void ST7735_SetDMACallback(void (*task)(void));
+
+//------------ST7735_DMABusy------------
+// Check if a uDMA FillRect or DrawBitmap is still being sent
+// While it is, a DrawBitmap image in RAM must not be changed
+// (ST7735_DMA 1 only)
+// Input: none
+// Output: nonzero while busy
+uint32_t ST7735_DMABusy(void);
+
 //------------ST7735_DrawCharS------------
 // Simple character draw function.  This is the same function from
 // Adafruit_GFX.c but adapted for this processor.  However, each call
@@ -267,7 +308,10 @@ void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, i
 // many extra data and commands.  If the background color is the same
 // as the text color, no background will be printed, and text can be
 // drawn right over existing images without covering them with a box.
-// Requires (11 + 2*size*size)*6*8 (image fully on screen; textcolor != bgColor)
+// Otherwise a character that is fully on the screen is passed to
+// ST7735_DrawChar, which sets the window once.
+// Requires (11 + size*size*6*8) bytes of transmission (image fully on screen; textcolor != bgColor)
+// Requires (11 + 2*size*size) bytes per set pixel (textcolor == bgColor)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
 //        c         character to be printed
@@ -281,7 +325,9 @@ void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t b
 // Advanced character draw function.  This is similar to the function
 // from Adafruit_GFX.c but adapted for this processor.  However, this
 // function only uses one call to setAddrWindow(), which allows it to
-// run at least twice as fast.
+// run at least twice as fast.  Size 1 glyphs are kept expanded for the
+// colors used (see ST7735_GLYPHCACHE), and sent in one burst (one uDMA
+// stream with ST7735_DMA 1).
 // Requires (11 + size*size*6*8) bytes of transmission (assuming image fully on screen)
 // Input: x         horizontal position of the top left corner of the character, columns from the left edge
 //        y         vertical position of the top left corner of the character, rows from the top edge
@@ -357,6 +403,25 @@ void ST7735_SetRotation(uint8_t m) ;
 // Output: none
 void ST7735_InvertDisplay(int i) ;
 
+//------------ST7735_SetScrollArea------------
+// Define the vertical scrolling area (VSCRDEF).  Rows above top and
+// the last bottom rows stay put; the rows between them wrap around as
+// ST7735_SetScrollStart moves them.  Drawing still uses the unscrolled
+// frame memory coordinates.  Meant for rotations 0 and 2.
+// Requires 7 bytes of transmission
+// Input: top    number of fixed rows at the top (0 for none)
+//        bottom number of fixed rows at the bottom (0 for none)
+// Output: none
+void ST7735_SetScrollArea(uint16_t top, uint16_t bottom);
+
+//------------ST7735_SetScrollStart------------
+// Pick the row shown first (at the top) of the scrolling area (VSCSAD)
+// Requires 3 bytes of transmission
+// Input: y row, from top to 159-bottom as given to ST7735_SetScrollArea
+//          (y=top shows the area unscrolled)
+// Output: none
+void ST7735_SetScrollStart(uint16_t y);
+
 // graphics routines
 // y coordinates 0 to 31 used for labels and messages
 // y coordinates 32 to 159  128 pixels high
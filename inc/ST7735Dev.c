@@ -0,0 +1,37 @@
+// ST7735Dev.c
+// Runs on TM4C123
+// DisplayDev_t adapter for the ST7735 128x160 color LCD (ST7735.c).
+// Every primitive is one ST7735 call: fill is one window, blit streams
+// the bitmap (by uDMA when ST7735_DMA is on), text is ST7735_DrawString
+// with one window per character, and the panel scrolls in hardware.
+
+#include <stdint.h>
+#include "DisplayDev.h"
+#include "ST7735.h"
+
+static void st7735Init(void){
+  Output_Init();                     // red tab, black screen
+}
+
+// ST7735_FillRect clips only at the right and bottom
+static void st7735Fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+  if(x < 0){ w = w + x; x = 0;}
+  if(y < 0){ h = h + y; y = 0;}
+  if((w <= 0) || (h <= 0)) return;
+  ST7735_FillRect(x, y, w, h, color);
+}
+
+static uint32_t st7735Text(uint16_t col, uint16_t row, const char *pt, uint16_t color){
+  return ST7735_DrawString(col, row, (char *)pt, color);
+}
+
+const DisplayDev_t ST7735_Dev = {
+  "ST7735", 128, 160, 6, 10, DISPLAYDEV_COLOR,
+  st7735Init,
+  st7735Fill,
+  ST7735_DrawBitmap,
+  st7735Text,
+  0,                                 // draws immediately
+  ST7735_SetScrollArea,
+  ST7735_SetScrollStart
+};
@@ -1,6 +1,6 @@
 // UART.h
 // LM4F120, TM4C123, TM4C1294
-// Simple device driver for the UART.
+// Simple device driver for the UART, implemented by UART0int.c (UARTx.c).
 // Daniel Valvano
 // Jan 3, 2020
 
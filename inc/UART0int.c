@@ -3,6 +3,10 @@
 // Use UART0 to implement bidirectional data transfer to and from a
 // computer running HyperTerminal.  This time, interrupts and FIFOs
 // are used.
+// U0Rx (VCP receive) connected to PA0
+// U0Tx (VCP transmit) connected to PA1
+// The driver itself is UARTx.c; this file only picks the UART0 settings.
+// Each setting can be overridden on the compiler command line.
 // Daniel Valvano
 // Jan 3, 2020
 // Modified by EE345L students Charlie Gough && Matt Hawk
@@ -25,481 +29,34 @@
  http://users.ece.utexas.edu/~valvano/
  */
 
-// U0Rx (VCP receive) connected to PA0
-// U0Tx (VCP transmit) connected to PA1
 #include <stdint.h>
-#include <stdio.h>
-#include <string.h>
-#include "../inc/tm4c123gh6pm.h"
-#include "../inc/CortexM.h"
-#include "../inc/FIFO.h"
 #include "../inc/UART0int.h"
 
-#define NVIC_EN0_INT5           0x00000020  // Interrupt 5 enable
-
-#define UART_FR_RXFF            0x00000040  // UART Receive FIFO Full
-#define UART_FR_TXFF            0x00000020  // UART Transmit FIFO Full
-#define UART_FR_RXFE            0x00000010  // UART Receive FIFO Empty
-#define UART_LCRH_WLEN_8        0x00000060  // 8 bit word length
-#define UART_LCRH_FEN           0x00000010  // UART Enable FIFOs
-#define UART_CTL_UARTEN         0x00000001  // UART Enable
-#define UART_IFLS_RX1_8         0x00000000  // RX FIFO >= 1/8 full
-#define UART_IFLS_TX1_8         0x00000000  // TX FIFO <= 1/8 full
-#define UART_IM_RTIM            0x00000040  // UART Receive Time-Out Interrupt
-                                            // Mask
-#define UART_IM_TXIM            0x00000020  // UART Transmit Interrupt Mask
-#define UART_IM_RXIM            0x00000010  // UART Receive Interrupt Mask
-#define UART_RIS_RTRIS          0x00000040  // UART Receive Time-Out Raw
-                                            // Interrupt Status
-#define UART_RIS_TXRIS          0x00000020  // UART Transmit Raw Interrupt
-                                            // Status
-#define UART_RIS_RXRIS          0x00000010  // UART Receive Raw Interrupt
-                                            // Status
-#define UART_ICR_RTIC           0x00000040  // Receive Time-Out Interrupt Clear
-#define UART_ICR_TXIC           0x00000020  // Transmit Interrupt Clear
-#define UART_ICR_RXIC           0x00000010  // Receive Interrupt Clear
-
-
-#define FIFOSIZE   1024       // size of the FIFOs (must be power of 2)
-#define FIFOSUCCESS 1         // return value on success
-#define FIFOFAIL    0         // return value on failure
-                              // create index implementation FIFO (see FIFO.h)
-AddIndexFifo(Rx, FIFOSIZE, char, FIFOSUCCESS, FIFOFAIL)
-AddIndexFifo(Tx, 1024, char, FIFOSUCCESS, FIFOFAIL)
-
-// Initialize UART0
-// Baud rate is 115200 bits/sec
-void UART_Init(void){
-  SYSCTL_RCGCUART_R |= 0x01;            // activate UART0
-  SYSCTL_RCGCGPIO_R |= 0x01;            // activate port A
-  RxFifo_Init();                        // initialize empty FIFOs
-  TxFifo_Init();
-  UART0_CTL_R &= ~UART_CTL_UARTEN;      // disable UART
-  UART0_IBRD_R = 43;                    // IBRD = int(80,000,000 / (16 * 115,200)) = int(43.403)
-  UART0_FBRD_R = 26;                    // FBRD = round(0.4028 * 64 ) = 26
-                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
-  UART0_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-  UART0_IFLS_R &= ~0x3F;                // clear TX and RX interrupt FIFO level fields
-                                        // configure interrupt for TX FIFO <= 1/8 full
-                                        // configure interrupt for RX FIFO >= 1/8 full
-  UART0_IFLS_R += (UART_IFLS_TX1_8|UART_IFLS_RX1_8);
-                                        // enable TX and RX FIFO interrupts and RX time-out interrupt
-  UART0_IM_R |= (UART_IM_RXIM|UART_IM_TXIM|UART_IM_RTIM);
-  UART0_CTL_R |= 0x301;                 // enable UART
-  GPIO_PORTA_AFSEL_R |= 0x03;           // enable alt funct on PA1-0
-  GPIO_PORTA_DEN_R |= 0x03;             // enable digital I/O on PA1-0
-                                        // configure PA1-0 as UART
-  GPIO_PORTA_PCTL_R = (GPIO_PORTA_PCTL_R&0xFFFFFF00)+0x00000011;
-  GPIO_PORTA_AMSEL_R = 0;               // disable analog functionality on PA
-                                        // UART0=priority 2
-  NVIC_PRI1_R = (NVIC_PRI1_R&0xFFFF00FF)|0x00004000; // bits 13-15
-  NVIC_EN0_R = NVIC_EN0_INT5;           // enable interrupt 5 in NVIC
-}
-// copy from hardware RX FIFO to software RX FIFO
-// stop when hardware RX FIFO is empty or software RX FIFO is full
-void static copyHardwareToSoftware(void){
-  char letter;
-  while(((UART0_FR_R&UART_FR_RXFE) == 0) && (RxFifo_Size() < (FIFOSIZE - 1))){
-    letter = UART0_DR_R;
-    RxFifo_Put(letter);
-  }
-}
-// copy from software TX FIFO to hardware TX FIFO
-// stop when software TX FIFO is empty or hardware TX FIFO is full
-void static copySoftwareToHardware(void){
-  char letter;
-  while(((UART0_FR_R&UART_FR_TXFF) == 0) && (TxFifo_Size() > 0)){
-    TxFifo_Get(&letter);
-    UART0_DR_R = letter;
-  }
-}
-// input ASCII character from UART
-// spin if RxFifo is empty
-char UART_InChar(void){
-  char letter;
-  while(RxFifo_Get(&letter) == FIFOFAIL){};
-  return(letter);
-}
-
-//------------UART_InCharNonBlock------------
-// input ASCII character from UART
-// output: 0 if RxFifo is empty
-//         character if
-char UART_InCharNonBlock(void){
-  char letter;
-  if(RxFifo_Get(&letter) == FIFOFAIL){
-    return 0;  // empty
-  };
-  return(letter);
-}
-
-//------------UART_OutChar------------
-// Output 8-bit to serial port
-// Input: letter is an 8-bit ASCII character to be transferred
-// Output: none
-// spin if TxFifo full
-void UART_OutChar(char data){
-  while(TxFifo_Put(data) == FIFOFAIL){};
-  UART0_IM_R &= ~UART_IM_TXIM;          // disable TX FIFO interrupt
-  copySoftwareToHardware();
-  UART0_IM_R |= UART_IM_TXIM;           // enable TX FIFO interrupt
-}
-//------------UART_OutCharNonBlock------------
-// non blocking output ASCII character to UART
-// Input: letter is an 8-bit ASCII character to be transferred
-// Output: none
-// Error: return with lost data if TxFifo is full
-void UART_OutCharNonBlock(char data){
-  if(TxFifo_Put(data) == FIFOFAIL) return; // lost data
-  UART0_IM_R &= ~UART_IM_TXIM;          // disable TX FIFO interrupt
-  copySoftwareToHardware();
-  UART0_IM_R |= UART_IM_TXIM;           // enable TX FIFO interrupt
-}
-// at least one of three things has happened:
-// hardware TX FIFO goes from 3 to 2 or less items
-// hardware RX FIFO goes from 1 to 2 or more items
-// UART receiver has timed out
-void UART0_Handler(void){
-  if(UART0_RIS_R&UART_RIS_TXRIS){       // hardware TX FIFO <= 2 items
-    UART0_ICR_R = UART_ICR_TXIC;        // acknowledge TX FIFO
-    // copy from software TX FIFO to hardware TX FIFO
-    copySoftwareToHardware();
-    if(TxFifo_Size() == 0){             // software TX FIFO is empty
-      UART0_IM_R &= ~UART_IM_TXIM;      // disable TX FIFO interrupt
-    }
-  }
-  if(UART0_RIS_R&UART_RIS_RXRIS){       // hardware RX FIFO >= 2 items
-    UART0_ICR_R = UART_ICR_RXIC;        // acknowledge RX FIFO
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-  if(UART0_RIS_R&UART_RIS_RTRIS){       // receiver timed out
-    UART0_ICR_R = UART_ICR_RTIC;        // acknowledge receiver time out
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-}
-
-//------------UART_OutString------------
-// Output String (NULL termination)
-// Input: pointer to a NULL-terminated string to be transferred
-// Output: none
-void UART_OutString(char *pt){
-  while(*pt){
-    UART_OutChar(*pt);
-    pt++;
-  }
-}
-
-//------------UART_InUDec------------
-// InUDec accepts ASCII input in unsigned decimal format
-//     and converts to a 32-bit unsigned number
-//     valid range is 0 to 4294967295 (2^32-1)
-// Input: none
-// Output: 32-bit unsigned number
-// If you enter a number above 4294967295, it will return an incorrect value
-// Backspace will remove last digit typed
-uint32_t UART_InUDec(void){
-uint32_t number=0, length=0;
-char character;
-  character = UART_InChar();
-  while(character != CR){ // accepts until <enter> is typed
-// The next line checks that the input is a digit, 0-9.
-// If the character is not 0-9, it is ignored and not echoed
-    if((character>='0') && (character<='9')) {
-      number = 10*number+(character-'0');   // this line overflows if above 4294967295
-      length++;
-      UART_OutChar(character);
-    }
-// If the input is a backspace, then the return number is
-// changed and a backspace is outputted to the screen
-    else if((character==BS) && length){
-      number /= 10;
-      length--;
-      UART_OutChar(character);
-    }
-    character = UART_InChar();
-  }
-  return number;
-}
-
-//-----------------------UART_OutUDec-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void UART_OutUDec(uint32_t n){
-// This function uses recursion to convert decimal number
-//   of unspecified length as an ASCII string
-  if(n >= 10){
-    UART_OutUDec(n/10);
-    n = n%10;
-  }
-  UART_OutChar(n+'0'); /* n is between 0 and 9 */
-}
-//-----------------------UART_OutSDec-----------------------
-// Output a 32-bit number in signed decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void UART_OutSDec(long n){
-  if(n<0){
-    UART_OutChar('-');
-    n = -n;
-  }
-  UART_OutUDec((unsigned long)n);
-}
-//---------------------UART_InUHex----------------------------------------
-// Accepts ASCII input in unsigned hexadecimal (base 16) format
-// Input: none
-// Output: 32-bit unsigned number
-// No '$' or '0x' need be entered, just the 1 to 8 hex digits
-// It will convert lower case a-f to uppercase A-F
-//     and converts to a 16 bit unsigned number
-//     value range is 0 to FFFFFFFF
-// If you enter a number above FFFFFFFF, it will return an incorrect value
-// Backspace will remove last digit typed
-uint32_t UART_InUHex(void){
-uint32_t number=0, digit, length=0;
-char character;
-  character = UART_InChar();
-  while(character != CR){
-    digit = 0x10; // assume bad
-    if((character>='0') && (character<='9')){
-      digit = character-'0';
-    }
-    else if((character>='A') && (character<='F')){
-      digit = (character-'A')+0xA;
-    }
-    else if((character>='a') && (character<='f')){
-      digit = (character-'a')+0xA;
-    }
-// If the character is not 0-9 or A-F, it is ignored and not echoed
-    if(digit <= 0xF){
-      number = number*0x10+digit;
-      length++;
-      UART_OutChar(character);
-    }
-// Backspace outputted and return value changed if a backspace is inputted
-    else if((character==BS) && length){
-      number /= 0x10;
-      length--;
-      UART_OutChar(character);
-    }
-    character = UART_InChar();
-  }
-  return number;
-}
-
-//--------------------------UART_OutUHex----------------------------
-// Output a 32-bit number in unsigned hexadecimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1 to 8 digits with no space before or after
-void UART_OutUHex(uint32_t number){
-// This function uses recursion to convert the number of
-//   unspecified length as an ASCII string
-  if(number >= 0x10){
-    UART_OutUHex(number/0x10);
-    UART_OutUHex(number%0x10);
-  }
-  else{
-    if(number < 0xA){
-      UART_OutChar(number+'0');
-     }
-    else{
-      UART_OutChar((number-0x0A)+'A');
-    }
-  }
-}
-
-/****************Fixed_Fix2Str***************
- converts fixed point number to ASCII string
- format signed 16-bit with resolution 0.01
- range -327.67 to +327.67
- Input: signed 16-bit integer part of fixed point number
-         -32768 means invalid fixed-point number
- Output: null-terminated string exactly 8 characters plus null
- Examples
-  12345 to " 123.45"  
- -22100 to "-221.00"
-   -102 to "  -1.02" 
-     31 to "   0.31" 
- -32768 to " ***.**"    
- */ 
-void Fixed_Fix2Str(long const num,char *string){
-  short n;
-  if((num>99999)||(num<-99990)){
-    strcpy((char *)string," ***.**");
-    return;
-  }
-  if(num<0){
-    n = -num;
-    string[0] = '-';
-  } else{
-    n = num;
-    string[0] = ' ';
-  }
-  if(n>9999){
-    string[1] = '0'+n/10000;
-    n = n%10000;
-    string[2] = '0'+n/1000;
-  } else{
-    if(n>999){
-      if(num<0){
-        string[0] = ' ';
-        string[1] = '-';
-      } else {
-        string[1] = ' ';
-      }
-      string[2] = '0'+n/1000;
-    } else{
-      if(num<0){
-        string[0] = ' ';
-        string[1] = ' ';
-        string[2] = '-';
-      } else {
-        string[1] = ' ';
-        string[2] = ' ';
-      }
-    }
-  }
-  n = n%1000;
-  string[3] = '0'+n/100;
-  n = n%100;
-  string[4] = '.';
-  string[5] = '0'+n/10;
-  n = n%10;
-  string[6] = '0'+n;
-  string[7] = 0;
-}
-//--------------------------UART_Fix2----------------------------
-// Output a 32-bit number in 0.01 fixed-point format
-// Input: 32-bit number to be transferred -99999 to +99999
-// Output: none
-// Fixed format 
-//  12345 to " 123.45"  
-// -22100 to "-221.00"
-//   -102 to "  -1.02" 
-//     31 to "   0.31" 
-// error     " ***.**"   
-void UART_Fix2(long number){
-  char message[10];
-  Fixed_Fix2Str(number,message);
-  UART_OutString(message);
-}
-
-//------------UART_InString------------
-// Accepts ASCII characters from the serial port
-//    and adds them to a string until <enter> is typed
-//    or until max length of the string is reached.
-// It echoes each character as it is inputted.
-// If a backspace is inputted, the string is modified
-//    and the backspace is echoed
-// terminates the string with a null character
-// uses busy-waiting synchronization on RDRF
-// Input: pointer to empty buffer, size of buffer
-// Output: Null terminated string
-// -- Modified by Agustinus Darmawan + Mingjie Qiu --
-void UART_InString(char *bufPt, uint16_t max) {
-int length=0;
-char character;
-  character = UART_InChar();
-  while(character != CR){
-    if(character == BS){
-      if(length){
-        bufPt--;
-        length--;
-        UART_OutChar(BS);
-      }
-    }
-    else if(length < max){
-      *bufPt = character;
-      bufPt++;
-      length++;
-      UART_OutChar(character);
-    }
-    character = UART_InChar();
-  }
-  *bufPt = 0;
-}
-
-
-// this is used for printf to output to the usb uart
-int fputc(int ch, FILE *f){
-  UART_OutChar(ch);
-  return 1;
-}
-// Get input from UART, echo
-int fgetc (FILE *f){
-  char ch = UART_InChar();  // receive from keyboard
-  UART_OutChar(ch);            // echo
-  return ch;
-}
-// Function called when file error occurs.
-int ferror(FILE *f){
-  /* Your implementation of ferror */
-  return EOF;
-}
-
-#ifdef __TI_COMPILER_VERSION__
-  //Code Composer Studio Code
-#include "file.h"
-int uart_open(const char *path, unsigned flags, int llv_fd){
-  UART_Init();
-  return 0;
-}
-int uart_close( int dev_fd){
-  return 0;
-}
-int uart_read(int dev_fd, char *buf, unsigned count){char ch;
-  ch = UART_InChar();    // receive from keyboard
-  ch = *buf;         // return by reference
-  UART_OutChar(ch);  // echo
-  return 1;
-}
-int uart_write(int dev_fd, const char *buf, unsigned count){ unsigned int num=count;
-  while(num){
-    UART_OutChar(*buf);
-    buf++;
-    num--;
-  }
-  return count;
-}
-off_t uart_lseek(int dev_fd, off_t ioffset, int origin){
-  return 0;
-}
-int uart_unlink(const char * path){
-  return 0;
-}
-int uart_rename(const char *old_name, const char *new_name){
-  return 0;
-}
-
-//------------Output_Init------------
-// Initialize the UART for 115,200 baud rate (assuming 80 MHz bus clock),
-// 8 bit word length, no parity bits, one stop bit
-// Input: none
-// Output: none
-void Output_Init(void){int ret_val; FILE *fptr;
-  UART_Init();
-  ret_val = add_device("uart", _SSA, uart_open, uart_close, uart_read, uart_write, uart_lseek, uart_unlink, uart_rename);
-  if(ret_val) return; // error
-  fptr = fopen("uart","w");
-  if(fptr == 0) return; // error
-  freopen("uart:", "w", stdout); // redirect stdout to uart
-  setvbuf(stdout, NULL, _IONBF, 0); // turn off buffering for stdout
-
-}
-#else
-//Keil uVision Code
-//------------Output_Init------------
-// Initialize the UART for 115,200 baud rate (assuming 80 MHz bus clock),
-// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
-// Input: none
-// Output: none
-void Output_Init(void){
-  UART_Init();
-}
+#ifndef UART0_BAUD
+#define UART0_BAUD       115200
+#endif
+#ifndef UART0_RXSIZE
+#define UART0_RXSIZE     1024   // software RX FIFO (or uDMA ring), 0 to poll
+#endif
+#ifndef UART0_TXSIZE
+#define UART0_TXSIZE     1024   // software TX FIFO, 0 to busy-wait
+#endif
+#ifndef UART0_DMA
+#define UART0_DMA        0      // 1 to move the data with uDMA channels 8,9
+#endif
+#ifndef UART0_PRI
+#define UART0_PRI        2      // NVIC priority
+#endif
+#ifndef UART0_STDIO
+#define UART0_STDIO      1      // printf and scanf use UART0 (0 with ST7735.c)
 #endif
 
+#define UART_NUM         0
+#define UART_API(f)      UART ## f    // UART0 keeps the plain UART_ names
+#define UART_BAUD        UART0_BAUD
+#define UART_RXSIZE      UART0_RXSIZE
+#define UART_TXSIZE      UART0_TXSIZE
+#define UART_DMA         UART0_DMA
+#define UART_PRI         UART0_PRI
+#define UART_STDIO       UART0_STDIO
+#include "../inc/UARTx.c"
@@ -69,6 +69,92 @@ void UART_OutChar(char data);
 // Error: return with lost data if TxFifo is full
 void UART_OutCharNonBlock(char data);
 
+//------------UART_SetRxTask------------
+// Have the interrupt handler call a function each time it receives
+// bytes, e.g. to wake a main loop sleeping in WaitForInterrupt
+// Not available with UART0_DMA, where the receive time-out never fires
+// Input: function to call in the handler, 0 for none
+// Output: none
+void UART_SetRxTask(void (*task)(void));
+
+//------------UART_InStatus------------
+// Returns how much data available for reading
+// Input: none
+// Output: number of bytes received and not yet read
+uint32_t UART_InStatus(void);
+
+//------------UART_Read------------
+// Input a block of bytes, spin until all have arrived
+// Input: buf is where to store the data
+//        len is the number of bytes to read
+// Output: number of bytes read (always len)
+uint32_t UART_Read(uint8_t *buf, uint32_t len);
+
+//------------UART_RxView------------
+// Look at the received bytes in place, without copying or removing them
+// The bytes are pt1[0..len1-1] followed by pt2[0..len2-1]; the second
+// run is only used when the data wraps around the end of the ring
+// The bytes stay valid until UART_RxCommit releases them
+// Not available with UART0_RXSIZE 0 (no receive ring)
+// Input: where to store the two runs
+// Output: len1+len2, the number of bytes available
+uint32_t UART_RxView(const uint8_t **pt1, uint32_t *len1, const uint8_t **pt2, uint32_t *len2);
+
+//------------UART_RxCommit------------
+// Release bytes seen with UART_RxView, oldest first
+// Input: len is the number of bytes parsed, at most what RxView returned
+// Output: none
+void UART_RxCommit(uint32_t len);
+
+//------------UART_Write------------
+// Output a buffer to the serial port, queued in one copy
+// Spins only while the software TX FIFO is full
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued (always len)
+uint32_t UART_Write(const uint8_t *buf, uint32_t len);
+
+//------------UART_WriteNonBlock------------
+// Output as much of a buffer as fits right now, never waits
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued, the caller resends the rest later
+uint32_t UART_WriteNonBlock(const uint8_t *buf, uint32_t len);
+
+//------------UART_FinishOutput------------
+// Wait for all transmission to finish
+// Input: none
+// Output: none
+void UART_FinishOutput(void);
+
+//------------UART_SetBaud------------
+// Change the baud rate, computed from Clock_GetFreq()
+// Input: baud rate in bits/sec, up to bus/8
+// Output: 1 on success, 0 if the rate is out of range (old rate kept)
+int UART_SetBaud(uint32_t baud);
+
+//------------UART_GetBaud------------
+// Input: none
+// Output: current baud rate in bits/sec
+uint32_t UART_GetBaud(void);
+
+//------------UART_SetRxLevel------------
+// Choose how full the hardware RX FIFO gets before it interrupts
+// Input: one of UART_IFLS_RX1_8 ... UART_IFLS_RX7_8
+// Output: none
+void UART_SetRxLevel(uint32_t level);
+
+//------------UART_GetRxStats------------
+// Read the receive interrupt counters, any pointer may be null
+// Input: pointers to fill in
+// Output: none
+void UART_GetRxStats(uint32_t *levelInts, uint32_t *timeoutInts,
+                     uint32_t *bytes, uint32_t *timeoutBytes);
+
+//------------UART_ClearRxStats------------
+// Zero the receive interrupt counters
+// Input: none
+// Output: none
+void UART_ClearRxStats(void);
+
 //------------UART_OutString------------
 // Output String (NULL termination)
 // Input: pointer to a NULL-terminated string to be transferred
@@ -1,13 +1,20 @@
 // UART1int.c
 // Runs on LM4F120/TM4C123
 // Use UART1 to implement bidirectional data transfer to and from another microcontroller
-// U1Rx PB0 is RxD (input to this microcontroller)
-// U1Tx PB1 is TxD (output of this microcontroller)
-// interrupts and FIFO used for receiver, busy-wait on transmit.
+// U1Rx PC4 is RxD (input to this microcontroller)
+// U1Tx PC5 is TxD (output of this microcontroller)
+// U1RTS PF0 is RTS (output, low when we can accept data)
+// U1CTS PF1 is CTS (input, other side lets us send when low)
+// (RTS/CTS are on with UART1_PORTC, UART1_FLOWCTL=0 leaves PF1-0 alone)
+// interrupts and FIFOs used for receiver and transmitter.
+// The driver itself is UARTx.c; this file only picks the UART1 settings.
+// Each setting can be overridden on the compiler command line, e.g. the
+// ESP8266 board (esp8266.c with USE_UART_DRV) uses
+//   UART1_PORTC=0 UART1_RXSIZE=0 UART1_TXSIZE=0 UART1_APPHANDLER=1
+// for U1Rx PB0, U1Tx PB1, busy-wait transmit and its own UART1_Handler.
 // Daniel Valvano
 // Jan 3, 2020
 
-
 /* This example accompanies the book
    "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
    ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2020
@@ -25,183 +32,43 @@
  http://users.ece.utexas.edu/~valvano/
  */
 
-
 #include <stdint.h>
-#include "../inc/tm4c123gh6pm.h"
-#include "../inc/CortexM.h"
-
 #include "../inc/UART1int.h"
-#define FIFOSIZE   256       // size of the FIFOs (must be power of 2)
-#define FIFOSUCCESS 1        // return value on success
-#define FIFOFAIL    0        // return value on failure
-uint32_t RxPutI;      // should be 0 to SIZE-1
-uint32_t RxGetI;      // should be 0 to SIZE-1 
-uint32_t RxFifoLost;  // should be 0 
-char RxFIFO[FIFOSIZE];
-void RxFifo_Init(void){
-  RxPutI = RxGetI = 0;                      // empty
-  RxFifoLost = 0; // occurs on overflow
-}
-int RxFifo_Put(char data){
-  if(((RxPutI+1)&(FIFOSIZE-1)) == RxGetI){
-    RxFifoLost++;
-    return FIFOFAIL; // fail if full  
-  }    
-  RxFIFO[RxPutI] = data;                    // save in FIFO
-  RxPutI = (RxPutI+1)&(FIFOSIZE-1);         // next place to put
-  return FIFOSUCCESS;
-}
-int RxFifo_Get(char *datapt){ 
-  if(RxPutI == RxGetI) return 0;            // fail if empty
-  *datapt = RxFIFO[RxGetI];                 // retrieve data
-  RxGetI = (RxGetI+1)&(FIFOSIZE-1);         // next place to get
-  return FIFOSUCCESS; 
-}
-                  
-//------------UART1_InStatus------------
-// Returns how much data available for reading
-// Input: none
-// Output: number of elements in receive FIFO
-uint32_t UART1_InStatus(void){  
- return ((RxPutI - RxGetI)&(FIFOSIZE-1));  
-}
-
-#define NVIC_EN0_INT6           0x00000040  // Interrupt 6 enable
-
-#define UART_FR_TXFE            0x00000080  // UART Transmit FIFO Empty
-#define UART_FR_RXFF            0x00000040  // UART Receive FIFO Full
-#define UART_FR_TXFF            0x00000020  // UART Transmit FIFO Full
-#define UART_FR_RXFE            0x00000010  // UART Receive FIFO Empty
-#define UART_FR_BUSY            0x00000008  // UART Transmit Busy
-#define UART_LCRH_WLEN_8        0x00000060  // 8 bit word length
-#define UART_LCRH_FEN           0x00000010  // UART Enable FIFOs
-#define UART_CTL_UARTEN         0x00000001  // UART Enable
-#define UART_IFLS_RX1_8         0x00000000  // RX FIFO >= 1/8 full
-#define UART_IFLS_TX1_8         0x00000000  // TX FIFO <= 1/8 full
-#define UART_IM_RTIM            0x00000040  // UART Receive Time-Out Interrupt
-                                            // Mask
-#define UART_IM_TXIM            0x00000020  // UART Transmit Interrupt Mask
-#define UART_IM_RXIM            0x00000010  // UART Receive Interrupt Mask
-#define UART_RIS_RTRIS          0x00000040  // UART Receive Time-Out Raw
-                                            // Interrupt Status
-#define UART_RIS_TXRIS          0x00000020  // UART Transmit Raw Interrupt
-                                            // Status
-#define UART_RIS_RXRIS          0x00000010  // UART Receive Raw Interrupt
-                                            // Status
-#define UART_ICR_RTIC           0x00000040  // Receive Time-Out Interrupt Clear
-#define UART_ICR_TXIC           0x00000020  // Transmit Interrupt Clear
-#define UART_ICR_RXIC           0x00000010  // Receive Interrupt Clear
-
-//------------UART1_Init------------
-// Initialize the UART1 for 115,200 baud rate (assuming 80 MHz clock),
-// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
-// Input: none
-// Output: none
-void UART1_Init(void){
-	SYSCTL_RCGCUART_R |= 0x0002;		// activate UART1
-	SYSCTL_RCGCGPIO_R |= 0x0004;		// activate PortC
-	SYSCTL_RCGCGPIO_R |= 0x0020;
-	while((SYSCTL_RCGCGPIO_R & 0x24) == 0);
-	UART1_CTL_R &= ~0x0001;					// disable UART
-	UART1_IBRD_R = 43;							// 80MHz, was 27
-	UART1_FBRD_R = 26; 							// 80MHz, was 8
-  UART1_LCRH_R = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
-	
-	//Init for Rx
-  UART1_IM_R |= (UART_IM_RXIM|UART_IM_RTIM);
-  UART1_IFLS_R += (UART_IFLS_TX1_8|UART_IFLS_RX1_8);
-	NVIC_PRI1_R = (NVIC_PRI1_R&~0x70000)+0x70000;
-  NVIC_EN0_R = NVIC_EN0_INT6;           // enable interrupt 6 in NVIC
-	
-	GPIO_PORTC_AFSEL_R |= 0x30; 		//alt func 
-	GPIO_PORTC_PCTL_R |= (GPIO_PORTC_PCTL_R&0xFF00FFFF)+0x00220000;
-	GPIO_PORTC_DEN_R |= 0x30;				// digital I/O on PC5-4
-	GPIO_PORTC_AMSEL_R &= ~0x30; 		// no analog on PC5-4
-	
-	GPIO_PORTF_AFSEL_R |= 0x03;
-	GPIO_PORTF_PCTL_R |= (GPIO_PORTF_PCTL_R & 0xFFFFFF00) + 0x00000011;
-	GPIO_PORTF_DEN_R |= 0x03;				// digital I/O on PC5-4
-	GPIO_PORTF_AMSEL_R &= ~0x03; 		// no analog on PC5-4
-
-	
-	UART1_CTL_R = 0xC301;
-	RxFifo_Init();                        // initialize empty FIFO
-}
-// copy from hardware RX FIFO to software RX FIFO
-// stop when hardware RX FIFO is empty or software RX FIFO is full
-void static copyHardwareToSoftware(void){
-  char letter;
-  while(((UART1_FR_R&UART_FR_RXFE) == 0) && (UART1_InStatus() < (FIFOSIZE - 1))){
-    letter = UART1_DR_R;
-    RxFifo_Put(letter);
-  }
-}
-
-// input ASCII character from UART
-// spin if RxFifo is empty
-char UART1_InChar(void){
-  char letter;
-  while(RxFifo_Get(&letter) == FIFOFAIL){};
-  return(letter);
-}
-//------------UART1_OutChar------------
-// Output 8-bit to serial port
-// Input: letter is an 8-bit ASCII character to be transferred
-// Output: none
-void UART1_OutChar(char data){
-  while((UART1_FR_R&UART_FR_TXFF) != 0);
-  UART1_DR_R = data;
-}
-// at least one of two things has happened:
-// hardware RX FIFO goes from 1 to 2 or more items
-// UART receiver has timed out
-void UART1_Handler(void){
-  if(UART1_RIS_R&UART_RIS_RXRIS){       // hardware RX FIFO >= 2 items
-    UART1_ICR_R = UART_ICR_RXIC;        // acknowledge RX FIFO
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-  if(UART1_RIS_R&UART_RIS_RTRIS){       // receiver timed out
-    UART1_ICR_R = UART_ICR_RTIC;        // acknowledge receiver time out
-    // copy from hardware RX FIFO to software RX FIFO
-    copyHardwareToSoftware();
-  }
-}
-
-//------------UART1_OutString------------
-// Output String (NULL termination)
-// Input: pointer to a NULL-terminated string to be transferred
-// Output: none
-void UART1_OutString(char *pt){
-  while(*pt){
-    UART1_OutChar(*pt);
-    pt++;
-  }
-}
 
-//-----------------------UART_OutUDec-----------------------
-// Output a 32-bit number in unsigned decimal format
-// Input: 32-bit number to be transferred
-// Output: none
-// Variable format 1-10 digits with no space before or after
-void UART_OutUDec(uint32_t n){
-// This function uses recursion to convert decimal number
-//   of unspecified length as an ASCII string
-  if(n >= 10){
-    UART_OutUDec(n/10);
-    n = n%10;
-  }
-  UART1_OutChar(n+'0'); /* n is between 0 and 9 */
-}
+#ifndef UART1_BAUD
+#define UART1_BAUD       115200 // rate the BGM220 NCP boots with
+#endif
+#ifndef UART1_RXSIZE
+#define UART1_RXSIZE     1024   // software RX FIFO (or uDMA ring), 0 to poll
+#endif
+#ifndef UART1_TXSIZE
+#define UART1_TXSIZE     1024   // software TX FIFO, 0 to busy-wait
+#endif
+#ifndef UART1_DMA
+#define UART1_DMA        0      // 1 to move the data with uDMA channels 22,23
+#endif
+#ifndef UART1_PRI
+#define UART1_PRI        7      // NVIC priority, as the old UART1int.c
+#endif
+#ifndef UART1_PORTC
+#define UART1_PORTC      1      // 1 for PC5-4, 0 for PB1-0
+#endif
+#ifndef UART1_FLOWCTL
+#define UART1_FLOWCTL    UART1_PORTC // RTS/CTS on PF0/PF1, wired on the NCP board
+#endif
+#ifndef UART1_APPHANDLER
+#define UART1_APPHANDLER 0      // 1 if the application owns UART1_Handler
+#endif
 
-//------------UART1_FinishOutput------------
-// Wait for all transmission to finish
-// Input: none
-// Output: none
-void UART1_FinishOutput(void){
-  // Wait for entire tx message to be sent
-  // UART Transmit FIFO Empty =1, when Tx done
-  while((UART1_FR_R&UART_FR_TXFE) == 0);
-  // wait until not busy
-  while((UART1_FR_R&UART_FR_BUSY));
-}
+#define UART_NUM         1
+#define UART_API(f)      UART1 ## f
+#define UART_BAUD        UART1_BAUD
+#define UART_RXSIZE      UART1_RXSIZE
+#define UART_TXSIZE      UART1_TXSIZE
+#define UART_DMA         UART1_DMA
+#define UART_PRI         UART1_PRI
+#define UART_PORTC       UART1_PORTC
+#define UART_FLOWCTL     UART1_FLOWCTL
+#define UART_APPHANDLER  UART1_APPHANDLER
+#define UART_STDIO       0
+#include "../inc/UARTx.c"
@@ -1,9 +1,10 @@
-// UART.h
+// UART1int.h
 // Runs on LM4F120/TM4C123
 // Use UART1 to implement bidirectional data transfer to and from another microcontroller
-// U1Rx PB0 is RxD (input to this microcontroller)
-// U1Tx PB1 is TxD (output of this microcontroller)
-// interrupts and FIFO used for receiver, busy-wait on transmit.
+// U1Rx PC4 is RxD (input to this microcontroller), PB0 with UART1_PORTC 0
+// U1Tx PC5 is TxD (output of this microcontroller), PB1 with UART1_PORTC 0
+// interrupts and FIFOs (or uDMA with UART1_DMA 1) used for receiver and
+// transmitter, see UART1int.c for the settings and UARTx.c for the driver.
 // Daniel Valvano
 // Jan 3, 2020
 
@@ -33,37 +34,232 @@
 #define DEL  0x7F
 
 //------------UART1_Init------------
-// Initialize the UART1 for 115,200 baud rate (assuming 80 MHz clock),
-// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Initialize the UART1 for 115,200 baud rate (divisor from Clock_GetFreq),
+// 8 bit word length, no parity bits, one stop bit, FIFOs enabled,
+// RTS/CTS flow control on PF0/PF1 (UART1_FLOWCTL in UART1int.c)
 // Input: none
 // Output: none
 void UART1_Init(void);
 
+//------------UART1_SetBaud------------
+// Change the baud rate, computed from Clock_GetFreq()
+// Waits for the transmitter to finish first, so nothing is sent at a mix
+// of rates.  Rates above bus/16 use the high-speed (ClkDiv=8) mode.
+// Input: baud rate in bits/sec, up to bus/8 (10 Mbps at 80 MHz)
+// Output: 1 on success, 0 if the rate is out of range (old rate kept)
+int UART1_SetBaud(uint32_t baud);
+
+//------------UART1_GetBaud------------
+// Input: none
+// Output: current baud rate in bits/sec
+uint32_t UART1_GetBaud(void);
+
+//------------UART1_FlowControl------------
+// Enable or disable hardware RTS/CTS on PF0 (U1RTS) and PF1 (U1CTS)
+// UART1_Init turns them on (UART1_FLOWCTL); 0 is for a device without
+// the lines.
+// RTS is deasserted while the receiver can not keep up, so the
+// other side pauses instead of overrunning the RX FIFO.
+// Input: 1 to enable, 0 to disable
+// Output: none
+void UART1_FlowControl(int enable);
+
+//------------UART1_SetRxLevel------------
+// Choose how full the hardware RX FIFO gets before it interrupts
+// A higher level means fewer interrupts per byte, and the receive
+// time-out still delivers the last bytes of a burst 32 bit times
+// (278 us at 115200 baud) after the line goes idle.  At 115200 a byte
+// takes 87 us, so the levels trade interrupts for latency as
+//   level  bytes/int  worst extra delay of a frame tail
+//   1/8      2          278 us (1 byte left over)
+//   1/2      8          278 us (up to 7 bytes left over)
+//   7/8     14          278 us (up to 13 bytes left over)
+// and a full hardware FIFO at 7/8 leaves 2 bytes (174 us) of ISR slack.
+// Input: one of UART_IFLS_RX1_8 (2 bytes), UART_IFLS_RX2_8 (4),
+//        UART_IFLS_RX4_8 (8), UART_IFLS_RX6_8 (12), UART_IFLS_RX7_8 (14)
+// Output: none
+// In uDMA mode the level stays at 1/2 to match the 8-byte DMA burst
+void UART1_SetRxLevel(uint32_t level);
+
+//------------UART1_GetRxStats------------
+// Read the receive interrupt counters, any pointer may be null
+// bytes/(levelInts+timeoutInts) is the average bytes per interrupt, and
+// timeoutBytes/bytes is the share that waited for the time-out
+// Input: pointers to fill in
+// Output: none
+void UART1_GetRxStats(uint32_t *levelInts, uint32_t *timeoutInts,
+                      uint32_t *bytes, uint32_t *timeoutBytes);
+
+//------------UART1_ClearRxStats------------
+// Zero the receive interrupt counters
+// Input: none
+// Output: none
+void UART1_ClearRxStats(void);
+
+//------------UART1_SetRxTask------------
+// Have the interrupt handler call a function each time it receives
+// bytes, e.g. to wake a main loop sleeping in WaitForInterrupt
+// Not available with UART1_DMA, where the receive time-out never fires
+// Input: function to call in the handler, 0 for none
+// Output: none
+void UART1_SetRxTask(void (*task)(void));
+
+//------------UART1_InStatus------------
+// Returns how much data available for reading
+// Input: none
+// Output: number of bytes received and not yet read
+uint32_t UART1_InStatus(void);
+
 //------------UART1_InChar------------
 // Wait for new serial port input
 // Input: none
 // Output: ASCII code for key typed
 char UART1_InChar(void);
 
+//------------UART1_InCharNonBlock------------
+// input ASCII character from UART
+// output: 0 if RxFifo is empty
+//         character if
+char UART1_InCharNonBlock(void);
+
+//------------UART1_Read------------
+// Input a block of bytes from UART1, spin until all have arrived
+// Copies whole runs out of the receive buffer instead of one call per byte
+// Input: buf is where to store the data
+//        len is the number of bytes to read
+// Output: number of bytes read (always len)
+uint32_t UART1_Read(uint8_t *buf, uint32_t len);
+
+//------------UART1_RxView------------
+// Look at the received bytes in place, without copying or removing them
+// The bytes are pt1[0..len1-1] followed by pt2[0..len2-1]; the second
+// run is only used when the data wraps around the end of the ring
+// The bytes stay valid until UART1_RxCommit releases them
+// Not available with UART1_RXSIZE 0 (no receive ring)
+// Input: where to store the two runs
+// Output: len1+len2, the number of bytes available
+uint32_t UART1_RxView(const uint8_t **pt1, uint32_t *len1, const uint8_t **pt2, uint32_t *len2);
+
+//------------UART1_RxCommit------------
+// Release bytes seen with UART1_RxView, oldest first
+// Input: len is the number of bytes parsed, at most what RxView returned
+// Output: none
+void UART1_RxCommit(uint32_t len);
+
 //------------UART1_OutChar------------
 // Output 8-bit to serial port
 // Input: letter is an 8-bit ASCII character to be transferred
 // Output: none
 void UART1_OutChar(char data);
 
+//------------UART1_OutCharNonBlock------------
+// non blocking output ASCII character to UART
+// Input: letter is an 8-bit ASCII character to be transferred
+// Output: none
+// Error: return with lost data if TxFifo is full
+void UART1_OutCharNonBlock(char data);
+
+//------------UART1_Write------------
+// Output a buffer to the serial port
+// The whole buffer is queued in one copy and the TX interrupt is armed
+// once, instead of once per byte as with UART1_OutChar
+// Spins only while the software TX FIFO is full
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued (always len)
+uint32_t UART1_Write(const uint8_t *buf, uint32_t len);
+
+//------------UART1_WriteNonBlock------------
+// Output as much of a buffer as fits right now, never waits
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued, the caller resends the rest later
+uint32_t UART1_WriteNonBlock(const uint8_t *buf, uint32_t len);
+
+//------------UART1_DMAOut------------
+// Send a buffer with uDMA, no CPU time per byte (UART1_DMA 1 only)
+// Waits for any previous UART1_DMAOut transfer to finish first
+// Input: buf is the data, which must not change until UART1_DMAOutBusy is 0
+//        len is the number of bytes
+// Output: none
+void UART1_DMAOut(const uint8_t *buf, uint32_t len);
+
+//------------UART1_DMAOutBusy------------
+// Check if a UART1_DMAOut transfer is still running
+// Input: none
+// Output: nonzero while the caller buffer is still in use
+uint32_t UART1_DMAOutBusy(void);
+
 //------------UART1_OutString------------
 // Output String (NULL termination)
 // Input: pointer to a NULL-terminated string to be transferred
 // Output: none
 void UART1_OutString(char *pt);
 
-//-----------------------UART_OutUDec-----------------------
+//------------UART1_InUDec------------
+// InUDec accepts ASCII input in unsigned decimal format
+//     and converts to a 32-bit unsigned number
+//     valid range is 0 to 4294967295 (2^32-1)
+// Input: none
+// Output: 32-bit unsigned number
+// If you enter a number above 4294967295, it will return an incorrect value
+// Backspace will remove last digit typed
+uint32_t UART1_InUDec(void);
+
+//-----------------------UART1_OutUDec-----------------------
 // Output a 32-bit number in unsigned decimal format
 // Input: 32-bit number to be transferred
 // Output: none
 // Variable format 1-10 digits with no space before or after
 void UART1_OutUDec(uint32_t n);
 
+//-----------------------UART1_OutSDec-----------------------
+// Output a 32-bit number in signed decimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+void UART1_OutSDec(long n);
+
+//---------------------UART1_InUHex----------------------------------------
+// Accepts ASCII input in unsigned hexadecimal (base 16) format
+// Input: none
+// Output: 32-bit unsigned number
+// Backspace will remove last digit typed
+uint32_t UART1_InUHex(void);
+
+//--------------------------UART1_OutUHex----------------------------
+// Output a 32-bit number in unsigned hexadecimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1 to 8 digits with no space before or after
+void UART1_OutUHex(uint32_t number);
+
+//--------------------------UART1_Fix2----------------------------
+// Output a 32-bit number in 0.01 fixed-point format
+// Input: 32-bit number to be transferred -99999 to +99999
+// Output: none
+// Fixed format, always 7 characters, e.g. 12345 to " 123.45"
+void UART1_Fix2(long number);
+
+//------------UART1_InString------------
+// Accepts ASCII characters from the serial port
+//    and adds them to a string until <enter> is typed
+//    or until max length of the string is reached.
+// It echoes each character as it is inputted.
+// Input: pointer to empty buffer, size of buffer
+// Output: Null terminated string
+void UART1_InString(char *bufPt, uint16_t max);
+
+//------------UART1_EnableRXInterrupt------------
+// Enable the UART1 interrupt in the NVIC
+// Input: none
+// Output: none
+void UART1_EnableRXInterrupt(void);
+
+//------------UART1_DisableRXInterrupt------------
+// Disable the UART1 interrupt in the NVIC
+// Input: none
+// Output: none
+void UART1_DisableRXInterrupt(void);
+
 //------------UART1_FinishOutput------------
 // Wait for all transmission to finish
 // Input: none
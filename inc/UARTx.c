@@ -0,0 +1,1279 @@
+// UARTx.c
+// Runs on LM4F120/TM4C123
+// One interrupt/uDMA UART driver for UART0 to UART7.
+// This file is not compiled by itself.  An instance file (UART0int.c,
+// UART1int.c, ...) sets the parameters below and then #includes it, so
+// the UART number, register addresses and FIFO sizes are compile-time
+// constants and each instance compiles to the same code a hand-written
+// driver for that UART would.  Fixes made here reach every instance.
+//   UART_NUM        0 to 7
+//   UART_API(f)     makes the public names, e.g. UART1 ## f gives UART1_Init
+//   UART_BAUD       baud rate set by Init
+//   UART_RXSIZE     software RX FIFO size (power of 2), or the uDMA RX ring
+//                   size when UART_DMA is 1 (2 to 2048), 0 to poll receive
+//   UART_TXSIZE     software TX FIFO size (power of 2), 0 to busy-wait
+//                   on transmit (needs UART_RXSIZE, which owns the vector)
+//   UART_DMA        1 to move RX and TX data with uDMA instead of the CPU
+//   UART_PRI        NVIC priority 0 to 7
+//   UART_APPHANDLER 1 if the application supplies UARTn_Handler itself;
+//                   RX and time-out interrupts are armed (UART_RXSIZE 0)
+//   UART_STDIO      1 to route printf/scanf through this UART
+//   UART_PORTC      UART1 only, 1 for PC5-4, 0 for PB1-0
+//   UART_FLOWCTL    UART1 only, 1 to have Init turn on RTS/CTS (PF0/PF1)
+// The instance file includes its header first (for CR and BS).
+// Daniel Valvano
+// Jan 3, 2020
+
+/* This example accompanies the book
+   "Embedded Systems: Real Time Interfacing to Arm Cortex M Microcontrollers",
+   ISBN: 978-1463590154, Jonathan Valvano, copyright (c) 2020
+   Program 5.11 Section 5.6, Program 3.10
+
+ Copyright 2020 by Jonathan W. Valvano, valvano@mail.utexas.edu
+    You may use, edit, run or distribute this file
+    as long as the above copyright notice remains
+ THIS SOFTWARE IS PROVIDED "AS IS".  NO WARRANTIES, WHETHER EXPRESS, IMPLIED
+ OR STATUTORY, INCLUDING, BUT NOT LIMITED TO, IMPLIED WARRANTIES OF
+ MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ VALVANO SHALL NOT, IN ANY CIRCUMSTANCES, BE LIABLE FOR SPECIAL, INCIDENTAL,
+ OR CONSEQUENTIAL DAMAGES, FOR ANY REASON WHATSOEVER.
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "../inc/tm4c123gh6pm.h"
+#include "../inc/CortexM.h"
+#include "../inc/FIFO.h"
+#include "../inc/DMAControl.h"
+#include "../inc/Clock.h"
+#include "../inc/Probe.h"
+
+#if !defined(UART_NUM) || !defined(UART_API)
+#error "UARTx.c is included by an instance file such as UART1int.c"
+#endif
+#ifndef UART_DMA
+#define UART_DMA 0
+#endif
+#ifndef UART_APPHANDLER
+#define UART_APPHANDLER 0
+#endif
+#ifndef UART_STDIO
+#define UART_STDIO 0
+#endif
+#ifndef UART_PRI
+#define UART_PRI 2
+#endif
+#ifndef UART_FLOWCTL
+#define UART_FLOWCTL 0
+#endif
+#if UART_FLOWCTL && (UART_NUM != 1)
+#error "only UART1 has RTS/CTS flow control"
+#endif
+#if UART_RXSIZE&(UART_RXSIZE-1) || UART_TXSIZE&(UART_TXSIZE-1)
+#error "UART_RXSIZE and UART_TXSIZE must be 0 or a power of 2"
+#endif
+#if UART_TXSIZE && !UART_RXSIZE && !UART_DMA
+#error "the TX FIFO is emptied by the driver's handler, which needs UART_RXSIZE"
+#endif
+#if UART_APPHANDLER && (UART_RXSIZE || UART_DMA)
+#error "UART_APPHANDLER is for polled receive (UART_RXSIZE 0)"
+#endif
+#if UART_DMA && ((UART_RXSIZE < 2) || (UART_RXSIZE > 2*DMA_MAXITEMS))
+#error "in uDMA mode UART_RXSIZE is the RX ring, 2 to 2048 bytes"
+#endif
+
+// Preprocessor magic to construct UARTn_ identifiers
+#define UART_CAT3(a,b,c)   a ## b ## c
+#define UART_XCAT3(a,b,c)  UART_CAT3(a,b,c)
+#define UARTR(REG)         UART_XCAT3(UART, UART_NUM, REG) // UARTR(_DR_R) is UART1_DR_R
+
+// pins, interrupt and uDMA channels of each UART
+#if UART_NUM==0
+#define UART_PORT(REG)  GPIO_PORTA ## REG  // U0Rx PA0, U0Tx PA1
+#define UART_GPIOBIT    0x01
+#define UART_PINS       0x03
+#define UART_PCTL_M     0x000000FF
+#define UART_PCTL       0x00000011
+#define UART_IRQ        5
+#define UART_DMARX      8
+#define UART_DMATX      9
+#define UART_DMAENC     0
+#elif UART_NUM==1
+#if UART_PORTC
+#define UART_PORT(REG)  GPIO_PORTC ## REG  // U1Rx PC4, U1Tx PC5
+#define UART_GPIOBIT    0x04
+#define UART_PINS       0x30
+#define UART_PCTL_M     0x00FF0000
+#define UART_PCTL       0x00220000
+#else
+#define UART_PORT(REG)  GPIO_PORTB ## REG  // U1Rx PB0, U1Tx PB1
+#define UART_GPIOBIT    0x02
+#define UART_PINS       0x03
+#define UART_PCTL_M     0x000000FF
+#define UART_PCTL       0x00000011
+#endif
+#define UART_IRQ        6
+#define UART_DMARX      22
+#define UART_DMATX      23
+#define UART_DMAENC     0
+#elif UART_NUM==2
+#define UART_PORT(REG)  GPIO_PORTD ## REG  // U2Rx PD6, U2Tx PD7
+#define UART_GPIOBIT    0x08
+#define UART_PINS       0xC0
+#define UART_PCTL_M     0xFF000000
+#define UART_PCTL       0x11000000
+#define UART_UNLOCK     1                  // PD7 is locked (NMI) out of reset
+#define UART_IRQ        33
+#define UART_DMARX      12
+#define UART_DMATX      13
+#define UART_DMAENC     1
+#elif UART_NUM==3
+#define UART_PORT(REG)  GPIO_PORTC ## REG  // U3Rx PC6, U3Tx PC7
+#define UART_GPIOBIT    0x04
+#define UART_PINS       0xC0
+#define UART_PCTL_M     0xFF000000
+#define UART_PCTL       0x11000000
+#define UART_IRQ        59
+#define UART_DMARX      16
+#define UART_DMATX      17
+#define UART_DMAENC     2
+#elif UART_NUM==4
+#define UART_PORT(REG)  GPIO_PORTC ## REG  // U4Rx PC4, U4Tx PC5
+#define UART_GPIOBIT    0x04
+#define UART_PINS       0x30
+#define UART_PCTL_M     0x00FF0000
+#define UART_PCTL       0x00110000
+#define UART_IRQ        60
+#define UART_DMARX      18
+#define UART_DMATX      19
+#define UART_DMAENC     2
+#elif UART_NUM==5
+#define UART_PORT(REG)  GPIO_PORTE ## REG  // U5Rx PE4, U5Tx PE5
+#define UART_GPIOBIT    0x10
+#define UART_PINS       0x30
+#define UART_PCTL_M     0x00FF0000
+#define UART_PCTL       0x00110000
+#define UART_IRQ        61
+#define UART_DMARX      6
+#define UART_DMATX      7
+#define UART_DMAENC     2
+#elif UART_NUM==6
+#define UART_PORT(REG)  GPIO_PORTD ## REG  // U6Rx PD4, U6Tx PD5
+#define UART_GPIOBIT    0x08
+#define UART_PINS       0x30
+#define UART_PCTL_M     0x00FF0000
+#define UART_PCTL       0x00110000
+#define UART_IRQ        62
+#define UART_DMARX      10
+#define UART_DMATX      11
+#define UART_DMAENC     2
+#elif UART_NUM==7
+#define UART_PORT(REG)  GPIO_PORTE ## REG  // U7Rx PE0, U7Tx PE1
+#define UART_GPIOBIT    0x10
+#define UART_PINS       0x03
+#define UART_PCTL_M     0x000000FF
+#define UART_PCTL       0x00000011
+#define UART_IRQ        63
+#define UART_DMARX      20
+#define UART_DMATX      21
+#define UART_DMAENC     2
+#else
+#error "UART_NUM must be 0 to 7"
+#endif
+#ifndef UART_UNLOCK
+#define UART_UNLOCK     0
+#endif
+
+// NVIC enable, disable and priority registers of UART_IRQ
+#define UART_NVIC_EN    ((&NVIC_EN0_R)[UART_IRQ>>5])
+#define UART_NVIC_DIS   ((&NVIC_DIS0_R)[UART_IRQ>>5])
+#define UART_NVIC_PRI   (((volatile uint8_t *)&NVIC_PRI0_R)[UART_IRQ])
+#define UART_NVIC_BIT   (1u<<(UART_IRQ&31))
+
+#define FIFOSUCCESS 1        // return value on success
+#define FIFOFAIL    0        // return value on failure
+
+static uint32_t Baud;                 // current baud rate
+#if UART_DMA
+static uint32_t RxLevel = UART_IFLS_RX4_8; // matches the 8-byte DMA burst
+#else
+static uint32_t RxLevel = UART_IFLS_RX1_8; // IFLS RX field
+#endif
+
+// receive interrupt counters, see UARTn_GetRxStats
+static uint32_t volatile RxLevelInts;   // RXRIS, hardware FIFO reached the level
+static uint32_t volatile RxTimeoutInts; // RTRIS, bytes below the level went idle
+static uint32_t volatile RxBytes;       // bytes moved to RxFifo
+static uint32_t volatile RxTimeoutBytes;// of those, bytes moved by RTRIS
+
+// software FIFOs, named UARTnRxFifo_ and UARTnTxFifo_ (see FIFO.h)
+#define AddUartFifo(NAME,SIZE) AddIndexFifo(NAME, SIZE, char, FIFOSUCCESS, FIFOFAIL)
+#if UART_RXSIZE && !UART_DMA
+AddUartFifo(UART_XCAT3(UART, UART_NUM, Rx), UART_RXSIZE)
+#define RxFifo_Init     UART_XCAT3(UART, UART_NUM, RxFifo_Init)
+#define RxFifo_Get      UART_XCAT3(UART, UART_NUM, RxFifo_Get)
+#define RxFifo_Size     UART_XCAT3(UART, UART_NUM, RxFifo_Size)
+#define RxFifo_GetN     UART_XCAT3(UART, UART_NUM, RxFifo_GetN)
+#define RxFifo_PutSpan  UART_XCAT3(UART, UART_NUM, RxFifo_PutSpan)
+#define RxFifo_PutCommit UART_XCAT3(UART, UART_NUM, RxFifo_PutCommit)
+#define RxFifo_GetView  UART_XCAT3(UART, UART_NUM, RxFifo_GetView)
+#define RxFifo_GetCommit UART_XCAT3(UART, UART_NUM, RxFifo_GetCommit)
+#endif
+#if UART_TXSIZE && !UART_DMA
+AddUartFifo(UART_XCAT3(UART, UART_NUM, Tx), UART_TXSIZE)
+#define TxFifo_Init     UART_XCAT3(UART, UART_NUM, TxFifo_Init)
+#define TxFifo_Put      UART_XCAT3(UART, UART_NUM, TxFifo_Put)
+#define TxFifo_PutN     UART_XCAT3(UART, UART_NUM, TxFifo_PutN)
+#define TxFifo_Size     UART_XCAT3(UART, UART_NUM, TxFifo_Size)
+#define TxFifo_GetSpan  UART_XCAT3(UART, UART_NUM, TxFifo_GetSpan)
+#define TxFifo_GetCommit UART_XCAT3(UART, UART_NUM, TxFifo_GetCommit)
+#endif
+
+// private function used to program the baud rate divisor
+// BRD = bus/(16*baud), FBRD is the fraction in 1/64ths
+// above bus/16 the UART runs with ClkDiv=8 (HSE) up to bus/8
+// the UART must be disabled, and LCRH is rewritten to latch the divisor
+// returns 0 if the baud rate can not be made from the bus clock
+static int setDivisor(uint32_t baud){
+  uint32_t bus = Clock_GetFreq();
+  uint32_t div;
+  if((baud == 0) || (baud > bus/8)){
+    return 0;
+  }
+  if(baud > bus/16){
+    div = (8*bus + baud/2)/baud;        // 64*bus/(8*baud), rounded
+    UARTR(_CTL_R) |= UART_CTL_HSE;
+  } else{
+    div = (4*bus + baud/2)/baud;        // 64*bus/(16*baud), rounded
+    UARTR(_CTL_R) &= ~UART_CTL_HSE;
+  }
+  if((div>>6) == 0){
+    return 0;
+  }
+  UARTR(_IBRD_R) = div>>6;              // e.g., 80MHz 115200 is 43
+  UARTR(_FBRD_R) = div&0x3F;            // e.g., 80MHz 115200 is 26
+  UARTR(_LCRH_R) = UARTR(_LCRH_R);      // divisor takes effect on LCRH write
+  Baud = baud;
+  return 1;
+}
+
+#if UART_RXSIZE && !UART_DMA
+// copy from hardware RX FIFO to software RX FIFO
+// stop when hardware RX FIFO is empty or software RX FIFO is full
+// bytes go straight into the free span of RxFifo, one commit per span
+// returns the number of bytes moved
+static uint32_t copyHardwareToSoftware(void){
+  char *pt;
+  uint32_t span, n, total = 0;
+  while((UARTR(_FR_R)&UART_FR_RXFE) == 0){
+    span = RxFifo_PutSpan(&pt);
+    if(span == 0){
+      break;                            // software RX FIFO is full
+    }
+    n = 0;
+    while((n < span) && ((UARTR(_FR_R)&UART_FR_RXFE) == 0)){
+      pt[n] = UARTR(_DR_R);
+      n++;
+    }
+    RxFifo_PutCommit(n);
+    total += n;
+  }
+  RxBytes += total;
+  return total;
+}
+#endif
+
+#if UART_TXSIZE && !UART_DMA
+// copy from software TX FIFO to hardware TX FIFO
+// stop when software TX FIFO is empty or hardware TX FIFO is full
+// bytes come straight from the used span of TxFifo, one commit per span
+static void copySoftwareToHardware(void){
+  char *pt;
+  uint32_t span, n;
+  while((UARTR(_FR_R)&UART_FR_TXFF) == 0){
+    span = TxFifo_GetSpan(&pt);
+    if(span == 0){
+      return;                           // software TX FIFO is empty
+    }
+    n = 0;
+    while((n < span) && ((UARTR(_FR_R)&UART_FR_TXFF) == 0)){
+      UARTR(_DR_R) = pt[n];
+      n++;
+    }
+    TxFifo_GetCommit(n);
+  }
+}
+
+// private function used to queue as much of a buffer as fits in TxFifo
+// and start sending it, with the TX interrupt masked only once
+static uint32_t txWrite(const uint8_t *buf, uint32_t len){
+  uint32_t n = TxFifo_PutN((const char *)buf, len);
+  if(n){
+    UARTR(_IM_R) &= ~UART_IM_TXIM;      // disable TX FIFO interrupt
+    copySoftwareToHardware();
+    UARTR(_IM_R) |= UART_IM_TXIM;       // enable TX FIFO interrupt
+  }
+  return n;
+}
+#endif
+
+#if UART_DMA
+//------------------------uDMA mode---------------------------------------
+// RX runs in ping-pong mode: the primary structure fills the first half
+// of RxDmaBuf and the alternate structure fills the second half, so the
+// buffer is a ring of two blocks that the hardware fills with no CPU help.
+#define DMABLOCK  (UART_RXSIZE/2)     // bytes per RX block
+#define RXBIT     (1u<<UART_DMARX)
+#define TXBIT     (1u<<UART_DMATX)
+#define CHRX      DMA_PRI(UART_DMARX)
+#define CHRXALT   DMA_ALT(UART_DMARX)
+#define CHTX      DMA_PRI(UART_DMATX)
+#define UART_CHMAP(ch) ((&UDMA_CHMAP0_R)[(ch)>>3])
+
+static char RxDmaBuf[2*DMABLOCK];
+static uint32_t volatile RxDmaPutI;   // bytes in completed blocks, never wraps back
+static uint32_t volatile RxDmaGetI;   // bytes read by the consumer
+static uint32_t volatile RxDmaArmed;  // bit0 primary, bit1 alternate queued
+static const uint8_t * volatile TxDmaPt; // next caller byte not yet given to DMA
+static uint32_t volatile TxDmaCount;  // caller bytes not yet given to DMA
+
+// private function used to program one RX block
+// half 0 is the primary structure, half 1 the alternate
+static void rxArm(uint32_t half){
+  uint32_t index = half? CHRXALT: CHRX;
+  ucControlTable[index]   = (uint32_t)&UARTR(_DR_R);               // fixed source
+  ucControlTable[index+1] = (uint32_t)&RxDmaBuf[half*DMABLOCK+DMABLOCK-1]; // last address
+  ucControlTable[index+2] = DMA_DSTINC_8|DMA_DSTSIZE_8|DMA_SRCINC_NONE|DMA_SRCSIZE_8|
+                            DMA_ARB_8|DMA_XFERSIZE(DMABLOCK)|DMA_MODE_PINGPONG;
+  RxDmaArmed |= (1<<half);
+}
+
+// account for finished RX blocks and re-arm any block the consumer released
+// called from the handler, or from main with interrupts disabled
+static void rxUpdate(void){
+  uint32_t half, k, block;
+  half = (RxDmaPutI/DMABLOCK)&1;      // block being filled
+  while((RxDmaArmed&(1<<half)) &&
+        ((ucControlTable[(half? CHRXALT: CHRX)+2]&DMA_MODE_M) == DMA_MODE_STOP)){
+    RxDmaArmed &= ~(1<<half);         // block is full
+    RxDmaPutI += DMABLOCK;
+    half ^= 1;
+  }
+  for(k=0; k<2; k++){
+    block = RxDmaPutI/DMABLOCK + k;
+    if(RxDmaArmed&(1<<(block&1))){
+      continue;                       // already queued
+    }
+    if((block*DMABLOCK - RxDmaGetI) > DMABLOCK){
+      break;                          // would land on bytes not yet read
+    }
+    rxArm(block&1);
+  }
+  if(RxDmaArmed && ((UDMA_ENASET_R&RXBIT) == 0)){
+    // channel stopped because both blocks filled, resume at the next block
+    if((RxDmaPutI/DMABLOCK)&1){
+      UDMA_ALTSET_R = RXBIT;
+    } else{
+      UDMA_ALTCLR_R = RXBIT;
+    }
+    UDMA_ENASET_R = RXBIT;
+  }
+}
+
+// number of received bytes the consumer has not read yet
+static uint32_t rxDmaStatus(void){ long sr;
+  uint32_t half, count;
+  sr = StartCritical();
+  rxUpdate();
+  half = (RxDmaPutI/DMABLOCK)&1;
+  count = RxDmaPutI - RxDmaGetI;
+  if(RxDmaArmed&(1<<half)){           // add the partly filled block
+    count += DMABLOCK - DMAControl_Remaining(half? CHRXALT: CHRX);
+  }
+  EndCritical(sr);
+  return count;
+}
+
+// read one byte known to be available
+static char rxDmaGet(void){ long sr;
+  char letter = RxDmaBuf[RxDmaGetI%(2*DMABLOCK)];
+  RxDmaGetI++;
+  if((RxDmaGetI%DMABLOCK) == 0){      // released a whole block
+    sr = StartCritical();
+    rxUpdate();
+    EndCritical(sr);
+  }
+  return letter;
+}
+
+// private function used to hand the next piece of the caller buffer to DMA
+static void txStart(void){
+  uint32_t count = TxDmaCount;
+  if(count > DMA_MAXITEMS){
+    count = DMA_MAXITEMS;
+  }
+  ucControlTable[CHTX]   = (uint32_t)(TxDmaPt+count-1);           // last address
+  ucControlTable[CHTX+1] = (uint32_t)&UARTR(_DR_R);               // fixed destination
+  ucControlTable[CHTX+2] = DMA_DSTINC_NONE|DMA_DSTSIZE_8|DMA_SRCINC_8|DMA_SRCSIZE_8|
+                           DMA_ARB_4|DMA_XFERSIZE(count)|DMA_MODE_BASIC;
+  TxDmaPt += count;
+  TxDmaCount -= count;
+  UDMA_ENASET_R = TXBIT;              // bit clears when done
+}
+
+// private function used by Init to route the UART requests to uDMA
+static void dmaInit(void){
+  DMAControl_Init();
+  UART_CHMAP(UART_DMARX) = (UART_CHMAP(UART_DMARX)&~(0xFu<<((UART_DMARX&7)*4)))|
+                           (UART_DMAENC<<((UART_DMARX&7)*4));
+  UART_CHMAP(UART_DMATX) = (UART_CHMAP(UART_DMATX)&~(0xFu<<((UART_DMATX&7)*4)))|
+                           (UART_DMAENC<<((UART_DMATX&7)*4));
+  UDMA_PRIOCLR_R = RXBIT|TXBIT;       // default, not high priority
+  UDMA_ALTCLR_R = RXBIT|TXBIT;        // use primary control
+  UDMA_USEBURSTCLR_R = RXBIT|TXBIT;   // responds to both burst and single requests
+  UDMA_REQMASKCLR_R = RXBIT|TXBIT;    // allow the uDMA controller to recognize requests
+  RxDmaPutI = RxDmaGetI = 0;
+  RxDmaArmed = 0;
+  TxDmaCount = 0;
+  rxUpdate();                         // arm both RX blocks and start the channel
+  UARTR(_DMACTL_R) = UART_DMACTL_RXDMAE|UART_DMACTL_TXDMAE;
+}
+
+//------------UARTn_DMAOutBusy------------
+// Check if a UARTn_DMAOut transfer is still running
+// Input: none
+// Output: nonzero while the caller buffer is still in use
+uint32_t UART_API(_DMAOutBusy)(void){
+  return TxDmaCount || (UDMA_ENASET_R&TXBIT);
+}
+
+//------------UARTn_DMAOut------------
+// Send a buffer with uDMA, no CPU time per byte
+// Waits for any previous UARTn_DMAOut transfer to finish first
+// Input: buf is the data, which must not change until UARTn_DMAOutBusy is 0
+//        len is the number of bytes
+// Output: none
+void UART_API(_DMAOut)(const uint8_t *buf, uint32_t len){
+  while(UART_API(_DMAOutBusy)()){};
+  if(len == 0){
+    return;
+  }
+  TxDmaPt = buf;
+  TxDmaCount = len;
+  txStart();
+}
+#endif
+
+#if UART_NUM==1
+// private function used to give PF1-0 to U1CTS and U1RTS
+static void flowPins(void){
+  SYSCTL_RCGCGPIO_R |= 0x0020;          // activate PortF
+  while((SYSCTL_PRGPIO_R&0x0020) == 0){};
+  GPIO_PORTF_LOCK_R = GPIO_LOCK_KEY;    // PF0 is locked (NMI) out of reset
+  GPIO_PORTF_CR_R |= 0x01;              // allow changes to PF0
+  GPIO_PORTF_AFSEL_R |= 0x03;           // alt func on PF1-0
+  GPIO_PORTF_PCTL_R = (GPIO_PORTF_PCTL_R&0xFFFFFF00)+0x00000011;
+  GPIO_PORTF_DEN_R |= 0x03;             // digital I/O on PF1-0
+  GPIO_PORTF_AMSEL_R &= ~0x03;          // no analog on PF1-0
+}
+#endif
+
+//------------UARTn_Init------------
+// Initialize the UART for UART_BAUD (divisor from Clock_GetFreq),
+// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Input: none
+// Output: none
+void UART_API(_Init)(void){
+  SYSCTL_RCGCUART_R |= (1<<UART_NUM);   // activate UART
+  SYSCTL_RCGCGPIO_R |= UART_GPIOBIT;    // activate port
+  while((SYSCTL_PRGPIO_R&UART_GPIOBIT) == 0){};
+#if UART_RXSIZE && !UART_DMA
+  RxFifo_Init();                        // initialize empty FIFOs
+#endif
+#if UART_TXSIZE && !UART_DMA
+  TxFifo_Init();
+#endif
+  UARTR(_CTL_R) &= ~UART_CTL_UARTEN;    // disable UART
+                                        // 8 bit word length (no parity bits, one stop bit, FIFOs)
+  UARTR(_LCRH_R) = (UART_LCRH_WLEN_8|UART_LCRH_FEN);
+  setDivisor(UART_BAUD);
+  UARTR(_IFLS_R) &= ~0x3F;              // clear TX and RX interrupt FIFO level fields
+                                        // TX FIFO <= 1/8 full, RX FIFO >= RxLevel
+  UARTR(_IFLS_R) += (UART_IFLS_TX1_8|RxLevel);
+#if UART_DMA
+  dmaInit();                            // only DMA completion interrupts
+#elif UART_RXSIZE || UART_APPHANDLER
+                                        // RX FIFO and time-out interrupts,
+                                        // TX is armed when data is queued
+  UARTR(_IM_R) |= (UART_IM_RXIM|UART_IM_RTIM);
+#endif
+#if UART_RXSIZE || UART_APPHANDLER || UART_DMA
+  UART_NVIC_PRI = UART_PRI<<5;          // priority in bits 7-5
+  UART_NVIC_EN = UART_NVIC_BIT;         // enable interrupt in NVIC
+#endif
+#if UART_FLOWCTL
+  flowPins();                           // RTS/CTS on
+  UARTR(_CTL_R) |= (UART_CTL_RTSEN|UART_CTL_CTSEN);
+#endif
+  UARTR(_CTL_R) |= (UART_CTL_RXE|UART_CTL_TXE|UART_CTL_UARTEN);
+#if UART_UNLOCK
+  UART_PORT(_LOCK_R) = GPIO_LOCK_KEY;   // unlock the pins
+  UART_PORT(_CR_R) |= UART_PINS;        // allow changes
+#endif
+  UART_PORT(_AFSEL_R) |= UART_PINS;     // enable alt funct on the pins
+  UART_PORT(_PCTL_R) = (UART_PORT(_PCTL_R)&~UART_PCTL_M)|UART_PCTL;
+  UART_PORT(_DEN_R) |= UART_PINS;       // enable digital I/O
+  UART_PORT(_AMSEL_R) &= ~UART_PINS;    // disable analog functionality
+}
+
+//------------UARTn_SetBaud------------
+// Change the baud rate, computed from Clock_GetFreq()
+// Waits for the transmitter to finish first, so nothing is sent at a mix
+// of rates.  Rates above bus/16 use the high-speed (ClkDiv=8) mode.
+// Input: baud rate in bits/sec, up to bus/8 (10 Mbps at 80 MHz)
+// Output: 1 on success, 0 if the rate is out of range (old rate kept)
+int UART_API(_SetBaud)(uint32_t baud){
+  uint32_t old = Baud;
+  UART_API(_FinishOutput)();
+  UARTR(_CTL_R) &= ~UART_CTL_UARTEN;    // disable UART
+  if(setDivisor(baud) == 0){
+    setDivisor(old);
+    UARTR(_CTL_R) |= UART_CTL_UARTEN;
+    return 0;
+  }
+  UARTR(_CTL_R) |= UART_CTL_UARTEN;     // enable UART
+  return 1;
+}
+
+//------------UARTn_GetBaud------------
+// Input: none
+// Output: current baud rate in bits/sec
+uint32_t UART_API(_GetBaud)(void){
+  return Baud;
+}
+
+#if UART_NUM==1
+//------------UART1_FlowControl------------
+// Enable or disable hardware RTS/CTS on PF0 (U1RTS) and PF1 (U1CTS)
+// With UART_FLOWCTL 1, UART1_Init has already turned them on.
+// With RTS on, the UART deasserts RTS when its hardware RX FIFO is full,
+// which happens as soon as the software RX FIFO (or both uDMA blocks)
+// stops being emptied, so the other side pauses instead of overrunning.
+// With CTS on, the transmitter waits while the other side holds CTS high.
+// Only UART1 has modem flow control on the TM4C123.
+// Input: 1 to enable, 0 to disable
+// Output: none
+void UART_API(_FlowControl)(int enable){
+  UART_API(_FinishOutput)();
+  UARTR(_CTL_R) &= ~UART_CTL_UARTEN;    // disable UART
+  if(enable){
+    flowPins();
+    UARTR(_CTL_R) |= (UART_CTL_RTSEN|UART_CTL_CTSEN);
+  } else{
+    UARTR(_CTL_R) &= ~(UART_CTL_RTSEN|UART_CTL_CTSEN);
+  }
+  UARTR(_CTL_R) |= UART_CTL_UARTEN;     // enable UART
+}
+#endif
+
+//------------UARTn_InStatus------------
+// Returns how much data available for reading
+// Input: none
+// Output: number of bytes received and not yet read
+//         (polled receive: 1 if the hardware FIFO has data, else 0)
+uint32_t UART_API(_InStatus)(void){
+#if UART_DMA
+  return rxDmaStatus();
+#elif UART_RXSIZE
+  return RxFifo_Size();
+#else
+  return (UARTR(_FR_R)&UART_FR_RXFE)? 0: 1;
+#endif
+}
+
+//------------UARTn_InChar------------
+// input ASCII character from UART
+// spin if RxFifo is empty
+char UART_API(_InChar)(void){
+#if UART_DMA
+  while(rxDmaStatus() == 0){};
+  return rxDmaGet();
+#elif UART_RXSIZE
+  char letter;
+  while(RxFifo_Get(&letter) == FIFOFAIL){};
+  return(letter);
+#else
+  while((UARTR(_FR_R)&UART_FR_RXFE) != 0){};
+  return((char)(UARTR(_DR_R)&0xFF));
+#endif
+}
+
+//------------UARTn_InCharNonBlock------------
+// input ASCII character from UART
+// output: 0 if RxFifo is empty
+//         character if
+char UART_API(_InCharNonBlock)(void){
+#if UART_DMA
+  if(rxDmaStatus() == 0){
+    return 0;  // empty
+  }
+  return rxDmaGet();
+#elif UART_RXSIZE
+  char letter;
+  if(RxFifo_Get(&letter) == FIFOFAIL){
+    return 0;  // empty
+  };
+  return(letter);
+#else
+  if(UARTR(_FR_R)&UART_FR_RXFE){
+    return 0;  // empty
+  }
+  return((char)(UARTR(_DR_R)&0xFF));
+#endif
+}
+
+//------------UARTn_Read------------
+// Input a block of bytes, spin until all have arrived
+// Copies whole runs out of the receive buffer instead of one call per byte
+// Input: buf is where to store the data
+//        len is the number of bytes to read
+// Output: number of bytes read (always len)
+uint32_t UART_API(_Read)(uint8_t *buf, uint32_t len){
+  uint32_t done = 0;
+#if UART_DMA
+  long sr;
+  uint32_t n, room;
+  while(done < len){
+    n = rxDmaStatus();
+    room = DMABLOCK - (RxDmaGetI%DMABLOCK); // stop at the block end
+    if(n > room) n = room;
+    if(n > len - done) n = len - done;
+    if(n == 0) continue;
+    memcpy(&buf[done], &RxDmaBuf[RxDmaGetI%(2*DMABLOCK)], n);
+    RxDmaGetI += n;
+    done += n;
+    if((RxDmaGetI%DMABLOCK) == 0){    // released a whole block
+      sr = StartCritical();
+      rxUpdate();
+      EndCritical(sr);
+    }
+  }
+#elif UART_RXSIZE
+  while(done < len){
+    done += RxFifo_GetN((char *)&buf[done], len - done);
+  }
+#else
+  while(done < len){
+    buf[done] = UART_API(_InChar)();
+    done++;
+  }
+#endif
+  return done;
+}
+
+#if UART_DMA || UART_RXSIZE
+//------------UARTn_RxView------------
+// Look at the received bytes in place, without copying or removing them
+// pt1[0..len1-1] then pt2[0..len2-1], len2 is 0 unless the data wraps
+// Input: where to store the two runs
+// Output: number of bytes available
+uint32_t UART_API(_RxView)(const uint8_t **pt1, uint32_t *len1, const uint8_t **pt2, uint32_t *len2){
+#if UART_DMA
+  uint32_t n = rxDmaStatus();         // bytes behind RxDmaGetI are not rewritten
+  uint32_t get = RxDmaGetI%(2*DMABLOCK);
+  *pt1 = (const uint8_t *)&RxDmaBuf[get];
+  *pt2 = (const uint8_t *)&RxDmaBuf[0];
+  if(n > 2*DMABLOCK - get){
+    *len1 = 2*DMABLOCK - get;
+    *len2 = n - *len1;
+  } else{
+    *len1 = n;
+    *len2 = 0;
+  }
+  return n;
+#else
+  return RxFifo_GetView((char **)pt1, len1, (char **)pt2, len2);
+#endif
+}
+
+//------------UARTn_RxCommit------------
+// Release bytes seen with UARTn_RxView, oldest first
+// Input: len is the number of bytes parsed
+// Output: none
+void UART_API(_RxCommit)(uint32_t len){
+#if UART_DMA
+  long sr;
+  uint32_t get = RxDmaGetI;
+  RxDmaGetI = get + len;
+  if((get/DMABLOCK) != (RxDmaGetI/DMABLOCK)){ // released a whole block
+    sr = StartCritical();
+    rxUpdate();
+    EndCritical(sr);
+  }
+#else
+  RxFifo_GetCommit(len);
+#endif
+}
+#endif
+
+//------------UARTn_OutChar------------
+// Output 8-bit to serial port
+// Input: letter is an 8-bit ASCII character to be transferred
+// Output: none
+void UART_API(_OutChar)(char data){
+#if UART_DMA
+  while(UART_API(_DMAOutBusy)()){};     // keep byte order with UARTn_DMAOut
+  while((UARTR(_FR_R)&UART_FR_TXFF) != 0){};
+  UARTR(_DR_R) = data;
+#elif UART_TXSIZE
+  while(TxFifo_Put(data) == FIFOFAIL){};
+  UARTR(_IM_R) &= ~UART_IM_TXIM;        // disable TX FIFO interrupt
+  copySoftwareToHardware();
+  UARTR(_IM_R) |= UART_IM_TXIM;         // enable TX FIFO interrupt
+#else
+  while((UARTR(_FR_R)&UART_FR_TXFF) != 0){};
+  UARTR(_DR_R) = data;
+#endif
+}
+
+//------------UARTn_OutCharNonBlock------------
+// non blocking output ASCII character to UART
+// Input: letter is an 8-bit ASCII character to be transferred
+// Output: none
+// Error: return with lost data if TxFifo is full
+void UART_API(_OutCharNonBlock)(char data){
+#if UART_DMA
+  if(UART_API(_DMAOutBusy)() || (UARTR(_FR_R)&UART_FR_TXFF)) return; // lost data
+  UARTR(_DR_R) = data;
+#elif UART_TXSIZE
+  if(TxFifo_Put(data) == FIFOFAIL) return; // lost data
+  UARTR(_IM_R) &= ~UART_IM_TXIM;        // disable TX FIFO interrupt
+  copySoftwareToHardware();
+  UARTR(_IM_R) |= UART_IM_TXIM;         // enable TX FIFO interrupt
+#else
+  if(UARTR(_FR_R)&UART_FR_TXFF) return; // lost data
+  UARTR(_DR_R) = data;
+#endif
+}
+
+//------------UARTn_Write------------
+// Output a buffer to the serial port
+// The whole buffer is queued in one copy and the TX interrupt is armed
+// once, instead of once per byte as with UARTn_OutChar
+// Spins only while the software TX FIFO is full
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued (always len)
+uint32_t UART_API(_Write)(const uint8_t *buf, uint32_t len){
+  uint32_t done = 0;
+#if UART_DMA
+  UART_API(_DMAOut)(buf, len);
+  while(UART_API(_DMAOutBusy)()){};     // caller may reuse buf on return
+  done = len;
+#elif UART_TXSIZE
+  while(done < len){
+    done += txWrite(&buf[done], len - done); // 0 while the ISR makes room
+  }
+#else
+  while(done < len){
+    while((UARTR(_FR_R)&UART_FR_TXFF) != 0){};
+    UARTR(_DR_R) = buf[done];
+    done++;
+  }
+#endif
+  return done;
+}
+
+//------------UARTn_WriteNonBlock------------
+// Output as much of a buffer as fits right now, never waits
+// Input: buf is the data, len is the number of bytes
+// Output: number of bytes queued, the caller resends the rest later
+uint32_t UART_API(_WriteNonBlock)(const uint8_t *buf, uint32_t len){
+#if UART_TXSIZE && !UART_DMA
+  return txWrite(buf, len);
+#else
+  uint32_t n = 0;
+#if UART_DMA
+  if(UART_API(_DMAOutBusy)()){
+    return 0;
+  }
+#endif
+  while((n < len) && ((UARTR(_FR_R)&UART_FR_TXFF) == 0)){
+    UARTR(_DR_R) = buf[n];
+    n++;
+  }
+  return n;
+#endif
+}
+
+#if UART_DMA || (UART_RXSIZE && !UART_APPHANDLER)
+PROBE_DEF(IsrProbe, "uart" PROBE_STR(UART_NUM) " isr", PROBE_NOPIN)
+#if !UART_DMA
+static void (*RxTask)(void);            // run by the handler when bytes arrive
+
+//------------UARTn_SetRxTask------------
+// Have the interrupt handler call a function each time it receives
+// bytes, e.g. to wake a main loop sleeping in WaitForInterrupt
+// Not built with UART_DMA: uDMA empties the hardware RX FIFO as bytes
+// arrive, so the receive time-out never fires and a short frame would
+// sit in a part-filled block without waking anyone
+// Input: function to call in the handler, 0 for none
+// Output: none
+void UART_API(_SetRxTask)(void (*task)(void)){
+  RxTask = task;
+}
+#endif
+
+// at least one of three things has happened:
+// hardware TX FIFO goes from 3 to 2 or less items
+// hardware RX FIFO goes from below to at least the RX level
+// UART receiver has timed out
+// in uDMA mode, one of the UART DMA channels has finished a structure
+void UARTR(_Handler)(void){
+  PROBE_BEGIN(IsrProbe);
+#if UART_DMA
+  if(UDMA_CHIS_R&RXBIT){              // RX block full
+    UDMA_CHIS_R = RXBIT;              // acknowledge
+    rxUpdate();
+  }
+  if(UDMA_CHIS_R&TXBIT){              // TX structure sent
+    UDMA_CHIS_R = TXBIT;              // acknowledge
+    if(TxDmaCount){
+      txStart();                      // rest of a long caller buffer
+    }
+  }
+#else
+  int received = 0;
+#if UART_TXSIZE
+  if(UARTR(_MIS_R)&UART_MIS_TXMIS){     // hardware TX FIFO <= 2 items, armed
+    UARTR(_ICR_R) = UART_ICR_TXIC;      // acknowledge TX FIFO
+    // copy from software TX FIFO to hardware TX FIFO
+    copySoftwareToHardware();
+    if(TxFifo_Size() == 0){             // software TX FIFO is empty
+      UARTR(_IM_R) &= ~UART_IM_TXIM;    // disable TX FIFO interrupt
+    }
+  }
+#endif
+  if(UARTR(_RIS_R)&UART_RIS_RXRIS){     // hardware RX FIFO >= RX level
+    UARTR(_ICR_R) = UART_ICR_RXIC;      // acknowledge RX FIFO
+    // copy from hardware RX FIFO to software RX FIFO
+    copyHardwareToSoftware();
+    RxLevelInts++;
+    received = 1;
+  }
+  if(UARTR(_RIS_R)&UART_RIS_RTRIS){     // receiver timed out
+    // bytes below the RX level sat idle for 32 bit times, this is how the
+    // tail of a frame gets delivered without waiting for more traffic
+    UARTR(_ICR_R) = UART_ICR_RTIC;      // acknowledge receiver time out
+    // copy from hardware RX FIFO to software RX FIFO
+    RxTimeoutBytes += copyHardwareToSoftware();
+    RxTimeoutInts++;
+    received = 1;
+  }
+  if(received && RxTask){
+    (*RxTask)();
+  }
+#endif
+  PROBE_END(IsrProbe);
+}
+#endif
+
+//------------UARTn_EnableRXInterrupt------------
+// Enable the UART interrupt in the NVIC
+// Input: none
+// Output: none
+void UART_API(_EnableRXInterrupt)(void){
+  UART_NVIC_EN = UART_NVIC_BIT;
+}
+
+//------------UARTn_DisableRXInterrupt------------
+// Disable the UART interrupt in the NVIC
+// Input: none
+// Output: none
+void UART_API(_DisableRXInterrupt)(void){
+  UART_NVIC_DIS = UART_NVIC_BIT;
+}
+
+//------------UARTn_SetRxLevel------------
+// Choose how full the hardware RX FIFO gets before it interrupts
+// A higher level means fewer interrupts per byte, and the receive
+// time-out still delivers the last bytes of a burst 32 bit times
+// after the line goes idle
+// Input: one of UART_IFLS_RX1_8 (2 bytes), UART_IFLS_RX2_8 (4),
+//        UART_IFLS_RX4_8 (8), UART_IFLS_RX6_8 (12), UART_IFLS_RX7_8 (14)
+// Output: none
+// In uDMA mode the level stays at 1/2 to match the 8-byte DMA burst
+void UART_API(_SetRxLevel)(uint32_t level){
+#if !UART_DMA
+  RxLevel = level&UART_IFLS_RX_M;
+  UARTR(_IFLS_R) = (UARTR(_IFLS_R)&~UART_IFLS_RX_M)|RxLevel;
+#endif
+}
+
+//------------UARTn_GetRxStats------------
+// Read the receive interrupt counters, any pointer may be null
+// bytes/(levelInts+timeoutInts) is the average bytes per interrupt, and
+// timeoutBytes/bytes is the share that waited for the time-out
+// Input: pointers to fill in
+// Output: none
+void UART_API(_GetRxStats)(uint32_t *levelInts, uint32_t *timeoutInts,
+                           uint32_t *bytes, uint32_t *timeoutBytes){
+  if(levelInts) *levelInts = RxLevelInts;
+  if(timeoutInts) *timeoutInts = RxTimeoutInts;
+  if(bytes) *bytes = RxBytes;
+  if(timeoutBytes) *timeoutBytes = RxTimeoutBytes;
+}
+
+//------------UARTn_ClearRxStats------------
+// Zero the receive interrupt counters
+// Input: none
+// Output: none
+void UART_API(_ClearRxStats)(void){ long sr;
+  sr = StartCritical();
+  RxLevelInts = RxTimeoutInts = 0;
+  RxBytes = RxTimeoutBytes = 0;
+  EndCritical(sr);
+}
+
+//------------UARTn_FinishOutput------------
+// Wait for all transmission to finish
+// Input: none
+// Output: none
+void UART_API(_FinishOutput)(void){
+  // Wait for the software TX FIFO or uDMA transfer to drain
+#if UART_DMA
+  while(UART_API(_DMAOutBusy)()){};
+#elif UART_TXSIZE
+  while(TxFifo_Size()){};
+#endif
+  // Wait for entire tx message to be sent
+  // UART Transmit FIFO Empty =1, when Tx done
+  while((UARTR(_FR_R)&UART_FR_TXFE) == 0);
+  // wait until not busy
+  while((UARTR(_FR_R)&UART_FR_BUSY));
+}
+
+//------------UARTn_OutString------------
+// Output String (NULL termination)
+// Input: pointer to a NULL-terminated string to be transferred
+// Output: none
+void UART_API(_OutString)(char *pt){
+  UART_API(_Write)((const uint8_t *)pt, strlen(pt));
+}
+
+//------------UARTn_InUDec------------
+// InUDec accepts ASCII input in unsigned decimal format
+//     and converts to a 32-bit unsigned number
+//     valid range is 0 to 4294967295 (2^32-1)
+// Input: none
+// Output: 32-bit unsigned number
+// If you enter a number above 4294967295, it will return an incorrect value
+// Backspace will remove last digit typed
+uint32_t UART_API(_InUDec)(void){
+uint32_t number=0, length=0;
+char character;
+  character = UART_API(_InChar)();
+  while(character != CR){ // accepts until <enter> is typed
+// The next line checks that the input is a digit, 0-9.
+// If the character is not 0-9, it is ignored and not echoed
+    if((character>='0') && (character<='9')) {
+      number = 10*number+(character-'0');   // this line overflows if above 4294967295
+      length++;
+      UART_API(_OutChar)(character);
+    }
+// If the input is a backspace, then the return number is
+// changed and a backspace is outputted to the screen
+    else if((character==BS) && length){
+      number /= 10;
+      length--;
+      UART_API(_OutChar)(character);
+    }
+    character = UART_API(_InChar)();
+  }
+  return number;
+}
+
+//-----------------------UARTn_OutUDec-----------------------
+// Output a 32-bit number in unsigned decimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+void UART_API(_OutUDec)(uint32_t n){
+// This function uses recursion to convert decimal number
+//   of unspecified length as an ASCII string
+  if(n >= 10){
+    UART_API(_OutUDec)(n/10);
+    n = n%10;
+  }
+  UART_API(_OutChar)(n+'0'); /* n is between 0 and 9 */
+}
+
+//-----------------------UARTn_OutSDec-----------------------
+// Output a 32-bit number in signed decimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1-10 digits with no space before or after
+void UART_API(_OutSDec)(long n){
+  if(n<0){
+    UART_API(_OutChar)('-');
+    n = -n;
+  }
+  UART_API(_OutUDec)((unsigned long)n);
+}
+
+//---------------------UARTn_InUHex----------------------------------------
+// Accepts ASCII input in unsigned hexadecimal (base 16) format
+// Input: none
+// Output: 32-bit unsigned number
+// No '$' or '0x' need be entered, just the 1 to 8 hex digits
+// It will convert lower case a-f to uppercase A-F
+//     and converts to a 16 bit unsigned number
+//     value range is 0 to FFFFFFFF
+// If you enter a number above FFFFFFFF, it will return an incorrect value
+// Backspace will remove last digit typed
+uint32_t UART_API(_InUHex)(void){
+uint32_t number=0, digit, length=0;
+char character;
+  character = UART_API(_InChar)();
+  while(character != CR){
+    digit = 0x10; // assume bad
+    if((character>='0') && (character<='9')){
+      digit = character-'0';
+    }
+    else if((character>='A') && (character<='F')){
+      digit = (character-'A')+0xA;
+    }
+    else if((character>='a') && (character<='f')){
+      digit = (character-'a')+0xA;
+    }
+// If the character is not 0-9 or A-F, it is ignored and not echoed
+    if(digit <= 0xF){
+      number = number*0x10+digit;
+      length++;
+      UART_API(_OutChar)(character);
+    }
+// Backspace outputted and return value changed if a backspace is inputted
+    else if((character==BS) && length){
+      number /= 0x10;
+      length--;
+      UART_API(_OutChar)(character);
+    }
+    character = UART_API(_InChar)();
+  }
+  return number;
+}
+
+//--------------------------UARTn_OutUHex----------------------------
+// Output a 32-bit number in unsigned hexadecimal format
+// Input: 32-bit number to be transferred
+// Output: none
+// Variable format 1 to 8 digits with no space before or after
+void UART_API(_OutUHex)(uint32_t number){
+// This function uses recursion to convert the number of
+//   unspecified length as an ASCII string
+  if(number >= 0x10){
+    UART_API(_OutUHex)(number/0x10);
+    UART_API(_OutUHex)(number%0x10);
+  }
+  else{
+    if(number < 0xA){
+      UART_API(_OutChar)(number+'0');
+     }
+    else{
+      UART_API(_OutChar)((number-0x0A)+'A');
+    }
+  }
+}
+
+/****************fix2Str***************
+ converts fixed point number to ASCII string
+ format signed 16-bit with resolution 0.01
+ range -327.67 to +327.67
+ Input: signed 16-bit integer part of fixed point number
+         -32768 means invalid fixed-point number
+ Output: null-terminated string exactly 8 characters plus null
+ Examples
+  12345 to " 123.45"
+ -22100 to "-221.00"
+   -102 to "  -1.02"
+     31 to "   0.31"
+ -32768 to " ***.**"
+ */
+static void fix2Str(long const num,char *string){
+  short n;
+  if((num>99999)||(num<-99990)){
+    strcpy((char *)string," ***.**");
+    return;
+  }
+  if(num<0){
+    n = -num;
+    string[0] = '-';
+  } else{
+    n = num;
+    string[0] = ' ';
+  }
+  if(n>9999){
+    string[1] = '0'+n/10000;
+    n = n%10000;
+    string[2] = '0'+n/1000;
+  } else{
+    if(n>999){
+      if(num<0){
+        string[0] = ' ';
+        string[1] = '-';
+      } else {
+        string[1] = ' ';
+      }
+      string[2] = '0'+n/1000;
+    } else{
+      if(num<0){
+        string[0] = ' ';
+        string[1] = ' ';
+        string[2] = '-';
+      } else {
+        string[1] = ' ';
+        string[2] = ' ';
+      }
+    }
+  }
+  n = n%1000;
+  string[3] = '0'+n/100;
+  n = n%100;
+  string[4] = '.';
+  string[5] = '0'+n/10;
+  n = n%10;
+  string[6] = '0'+n;
+  string[7] = 0;
+}
+
+//--------------------------UARTn_Fix2----------------------------
+// Output a 32-bit number in 0.01 fixed-point format
+// Input: 32-bit number to be transferred -99999 to +99999
+// Output: none
+// Fixed format
+//  12345 to " 123.45"
+// -22100 to "-221.00"
+//   -102 to "  -1.02"
+//     31 to "   0.31"
+// error     " ***.**"
+void UART_API(_Fix2)(long number){
+  char message[10];
+  fix2Str(number,message);
+  UART_API(_OutString)(message);
+}
+
+//------------UARTn_InString------------
+// Accepts ASCII characters from the serial port
+//    and adds them to a string until <enter> is typed
+//    or until max length of the string is reached.
+// It echoes each character as it is inputted.
+// If a backspace is inputted, the string is modified
+//    and the backspace is echoed
+// terminates the string with a null character
+// Input: pointer to empty buffer, size of buffer
+// Output: Null terminated string
+// -- Modified by Agustinus Darmawan + Mingjie Qiu --
+void UART_API(_InString)(char *bufPt, uint16_t max) {
+int length=0;
+char character;
+  character = UART_API(_InChar)();
+  while(character != CR){
+    if(character == BS){
+      if(length){
+        bufPt--;
+        length--;
+        UART_API(_OutChar)(BS);
+      }
+    }
+    else if(length < max){
+      *bufPt = character;
+      bufPt++;
+      length++;
+      UART_API(_OutChar)(character);
+    }
+    character = UART_API(_InChar)();
+  }
+  *bufPt = 0;
+}
+
+#if UART_STDIO
+// this is used for printf to output to the usb uart
+int fputc(int ch, FILE *f){
+  UART_API(_OutChar)(ch);
+  return 1;
+}
+// Get input from UART, echo
+int fgetc (FILE *f){
+  char ch = UART_API(_InChar)();  // receive from keyboard
+  UART_API(_OutChar)(ch);         // echo
+  return ch;
+}
+// Function called when file error occurs.
+int ferror(FILE *f){
+  /* Your implementation of ferror */
+  return EOF;
+}
+
+#ifdef __TI_COMPILER_VERSION__
+  //Code Composer Studio Code
+#include "file.h"
+int uart_open(const char *path, unsigned flags, int llv_fd){
+  UART_API(_Init)();
+  return 0;
+}
+int uart_close( int dev_fd){
+  return 0;
+}
+int uart_read(int dev_fd, char *buf, unsigned count){char ch;
+  ch = UART_API(_InChar)();    // receive from keyboard
+  ch = *buf;         // return by reference
+  UART_API(_OutChar)(ch);  // echo
+  return 1;
+}
+int uart_write(int dev_fd, const char *buf, unsigned count){ unsigned int num=count;
+  while(num){
+    UART_API(_OutChar)(*buf);
+    buf++;
+    num--;
+  }
+  return count;
+}
+off_t uart_lseek(int dev_fd, off_t ioffset, int origin){
+  return 0;
+}
+int uart_unlink(const char * path){
+  return 0;
+}
+int uart_rename(const char *old_name, const char *new_name){
+  return 0;
+}
+
+//------------Output_Init------------
+// Initialize the UART for 115,200 baud rate (assuming 80 MHz bus clock),
+// 8 bit word length, no parity bits, one stop bit
+// Input: none
+// Output: none
+void Output_Init(void){int ret_val; FILE *fptr;
+  UART_API(_Init)();
+  ret_val = add_device("uart", _SSA, uart_open, uart_close, uart_read, uart_write, uart_lseek, uart_unlink, uart_rename);
+  if(ret_val) return; // error
+  fptr = fopen("uart","w");
+  if(fptr == 0) return; // error
+  freopen("uart:", "w", stdout); // redirect stdout to uart
+  setvbuf(stdout, NULL, _IONBF, 0); // turn off buffering for stdout
+
+}
+#else
+//Keil uVision Code
+//------------Output_Init------------
+// Initialize the UART for 115,200 baud rate (assuming 80 MHz bus clock),
+// 8 bit word length, no parity bits, one stop bit, FIFOs enabled
+// Input: none
+// Output: none
+void Output_Init(void){
+  UART_API(_Init)();
+}
+#endif
+#endif
@@ -70,6 +70,9 @@
 // #define ESP8266_UART     2   // UART2: PD7/PB6
 
 #define USE_UART_DRV  // Use external UART driver (only works with UART1)
+                      // build UART1int.c with UART1_PORTC=0 UART1_RXSIZE=0
+                      // UART1_TXSIZE=0 UART1_APPHANDLER=1, this file
+                      // owns UART1_Handler
 
 #define FIFOSIZE    1024      // size of the FIFOs (must be power of 2)
 #define FIFOSUCCESS 1         // return value on success
@@ -223,9 +226,9 @@ bool ReceiveDataFilter(char letter){
 #ifdef USE_UART_DRV
 
 #if ESP8266_UART==1
-#include "../inc/UART1.h"
+#include "../inc/UART1int.h"
 #elif ESP8266_UART==2
-#include "../inc/UART2.h"
+#include "../inc/UART2int.h"
 #endif
 
 //--------ESP8266_InitUart--------
@@ -238,7 +241,8 @@ void ESP8266_InitUART(int rx_echo, int tx_echo){
   ESP8266Rx0Fifo_Init();  
   ESP8266_EchoResponse = rx_echo;
   ESP8266_EchoCommand = tx_echo;
-  UART_ESP8266(_Init)(BAUDRATE);
+  UART_ESP8266(_Init)();
+  UART_ESP8266(_SetBaud)(BAUDRATE);
 }
 
 //--------ESP8266_OutChar--------
@@ -374,13 +378,22 @@ void ESP8266_DisableInterrupt(void){
 // Inputs: none
 // Outputs:none
 void static ESP8266BufferToTx(void){
-  char letter;
-  while(((UART_ESP8266(_FR_R)&UART_FR_TXFF) == 0) && (ESP8266TxFifo_Size() > 0)){
-    ESP8266TxFifo_Get(&letter);
-    if(ESP8266_EchoCommand){
-      UART_OutCharNonBlock(letter); // echo
+  char *pt;
+  uint32_t span, n;
+  while((UART_ESP8266(_FR_R)&UART_FR_TXFF) == 0){
+    span = ESP8266TxFifo_GetSpan(&pt);  // bytes readable in place
+    if(span == 0){
+      return;                           // software TX FIFO is empty
+    }
+    n = 0;
+    while((n < span) && ((UART_ESP8266(_FR_R)&UART_FR_TXFF) == 0)){
+      if(ESP8266_EchoCommand){
+        UART_OutCharNonBlock(pt[n]);    // echo
+      }
+      UART_ESP8266(_DR_R) = pt[n];
+      n++;
     }
-    UART_ESP8266(_DR_R) = letter;
+    ESP8266TxFifo_GetCommit(n);
   }
 }
 
@@ -451,10 +464,20 @@ char ESP8266_InChar(void){ char letter;
 // Inputs: string to send (null-terminated)
 // Outputs: none
 void ESP8266_SendCommand(const char* command){
-  int index = 0;
-  while(command[index] != 0){
-    ESP8266_OutChar(command[index++]);
+#ifndef USE_UART_DRV
+  uint32_t len = strlen(command), n;
+  while(len){                           // whole string in at most two copies
+    n = ESP8266TxFifo_PutN(command, len);
+    command += n;
+    len -= n;
+    UART_ESP8266(_IM_R) &= ~UART_IM_TXIM;        // disable TX FIFO interrupt
+    ESP8266BufferToTx();
+    UART_ESP8266(_IM_R) |= UART_IM_TXIM;         // enable TX FIFO interrupt
   }
+#else
+  UART_ESP8266(_OutString)((char *)command);     // whole string in one driver call
+  if(ESP8266_EchoCommand) UART_OutString((char *)command); // echo debugging
+#endif
 }
 
 //---------ESP8266_WaitForResponse-----
@@ -462,23 +485,29 @@ void ESP8266_SendCommand(const char* command){
 // Inputs: Success or failure strings to search for
 // Outputs: 1 on success, 0 on failure
 int ESP8266_WaitForResponse(const char *success, const char* failure) {
-  char d;
+  char d, *pt1, *pt2;
+  uint32_t len1, len2, n, i;
   const char *s = success;
   const char *f = failure;
   while((!s || *s) && (!f || *f)) {   // end of search string reached?
-    d = ESP8266_InChar(); 
-    if(s && (d == *s)) {
-      s++;
-    } else {
-      s = success;  // start over
-      if(s && (d == *s)) s++;  // match first char?
-    }
-    if(f && (d == *f)) {
-      f++;
-    } else {
-      f = failure;  // start over
-      if(f && (d == *f)) f++;  // match first char? 
+    // match in place in the RX FIFO, then release what was scanned
+    n = ESP8266RxFifo_GetView(&pt1, &len1, &pt2, &len2);
+    for(i = 0; (i < n) && (!s || *s) && (!f || *f); i++) {
+      d = (i < len1)? pt1[i]: pt2[i - len1];
+      if(s && (d == *s)) {
+        s++;
+      } else {
+        s = success;  // start over
+        if(s && (d == *s)) s++;  // match first char?
+      }
+      if(f && (d == *f)) {
+        f++;
+      } else {
+        f = failure;  // start over
+        if(f && (d == *f)) f++;  // match first char? 
+      }
     }
+    ESP8266RxFifo_GetCommit(i);
   }
   if(failure && !(*f)) return FAILURE;
   return SUCCESS;  
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Decode a BGAPI trace dump from the TM4C (see TM4C/BGLib/sl_bt_ncp_trace.h).
+
+Capture the dump from UART0 (115200 8N1) into a file, e.g.
+  stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 > dump.bin
+then
+  python3 tools/bgtrace_decode.py dump.bin [--bin-ms 100] [--list]
+
+Prints, using the message IDs in TM4C/BGLib/sl_bt_types.h:
+  * per-command latency (command sent -> response header received) as
+    log2 histograms in microseconds
+  * an event-rate timeline: events of each type per --bin-ms window
+  * with --list, every record with its timestamp
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+from collections import defaultdict
+
+TYPES_H = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                       '..', 'TM4C', 'BGLib', 'sl_bt_types.h')
+TRACE_TX = 0x40
+KEY_MASK = 0xffff00b8    # class, message id, event bit and device type
+
+
+def load_names():
+    names = {}
+    with open(TYPES_H) as f:
+        for kind, name, value in re.findall(
+                r'#define sl_bt_(cmd|evt)_(\w+)_id\s+(0x[0-9a-fA-F]+)', f.read()):
+            names[(kind, int(value, 16) & KEY_MASK)] = name
+    return names
+
+
+def read_dump(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    start = data.find(b'BGTR')
+    if start < 0:
+        sys.exit('no BGTR header in ' + path)
+    version, freq, count = struct.unpack_from('<III', data, start + 4)
+    if version != 1:
+        sys.exit('unknown trace version %d' % version)
+    body = data[start + 16:]
+    count = min(count, len(body) // 8)
+    records = []
+    last = None
+    high = 0
+    for i in range(count):
+        cycles, header = struct.unpack_from('<II', body, i * 8)
+        if last is not None and cycles < last:
+            high += 1 << 32        # the 32-bit cycle counter wrapped
+        last = cycles
+        records.append(((high + cycles) / freq, header))
+    return freq, records
+
+
+def describe(header, names):
+    key = header & KEY_MASK
+    if header & 0x80:
+        return 'evt', names.get(('evt', key), 'evt_%08x' % key)
+    kind = 'cmd' if header & TRACE_TX else 'rsp'
+    return kind, names.get(('cmd', key), 'cmd_%08x' % key)
+
+
+def histogram(samples):
+    buckets = defaultdict(int)
+    for us in samples:
+        b = 0
+        while (1 << (b + 1)) <= us:
+            b += 1
+        buckets[b] += 1
+    width = max(buckets.values())
+    lines = []
+    for b in range(min(buckets), max(buckets) + 1):
+        n = buckets.get(b, 0)
+        bar = '#' * (40 * n // width) if n else ''
+        lines.append('    %7d-%-7d us %6d %s' % (1 << b if b else 0, (1 << (b + 1)) - 1, n, bar))
+    return lines
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('dump')
+    ap.add_argument('--bin-ms', type=float, default=100.0, help='timeline window')
+    ap.add_argument('--list', action='store_true', help='print every record')
+    args = ap.parse_args()
+
+    names = load_names()
+    freq, records = read_dump(args.dump)
+    print('%d records, %.3f s, cycle counter %d Hz' % (
+        len(records), records[-1][0] - records[0][0] if records else 0, freq))
+
+    latency = defaultdict(list)
+    events = defaultdict(list)
+    pending = None
+    for t, header in records:
+        kind, name = describe(header, names)
+        if args.list:
+            print('%12.6f  %s %-45s len %d' % (t, kind, name, (header >> 8) & 0xff | (header & 7) << 8))
+        if kind == 'cmd':
+            pending = (t, header & KEY_MASK, name)
+        elif kind == 'rsp' and pending and pending[1] == header & KEY_MASK:
+            latency[pending[2]].append((t - pending[0]) * 1e6)
+            pending = None
+        elif kind == 'evt':
+            events[name].append(t)
+
+    print('\nCommand latency (command sent to response header):')
+    for name in sorted(latency):
+        s = sorted(latency[name])
+        print('  %s  n=%d  min %.0f  median %.0f  max %.0f us' % (
+            name, len(s), s[0], s[len(s) // 2], s[-1]))
+        for line in histogram(s):
+            print(line)
+
+    if events:
+        t0 = records[0][0]
+        order = sorted(events)
+        bins = defaultdict(lambda: [0] * len(order))
+        for col, name in enumerate(order):
+            for t in events[name]:
+                bins[int((t - t0) * 1000 / args.bin_ms)][col] += 1
+        print('\nEvents per %g ms window:' % args.bin_ms)
+        for col, name in enumerate(order):
+            print('  [%d] %s (%d total)' % (col, name, len(events[name])))
+        print('  %10s  %s' % ('t (s)', ' '.join('%5s' % ('[%d]' % c) for c in range(len(order)))))
+        for b in sorted(bins):
+            print('  %10.3f  %s' % (b * args.bin_ms / 1000, ' '.join('%5d' % c for c in bins[b])))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
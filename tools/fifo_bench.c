@@ -0,0 +1,129 @@
+// fifo_bench.c
+// Runs on the host (Linux, macOS), not on the TM4C
+// Compares the index FIFO of FIFO.h with the pool-backed linked queue of
+// LLFifo.c for the two ways the firmware uses queues: single words, and
+// whole messages (BGAPI events, display commands).  Build and run with
+//   gcc -O2 -o fifo_bench tools/fifo_bench.c inc/Pool.c inc/LLFifo.c
+//   ./fifo_bench
+// The host numbers only rank the implementations; absolute cycle counts
+// on the Cortex-M4 differ (no cache, and StartCritical is two
+// instructions there but a function call stub here).
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../inc/FIFO.h"
+#include "../inc/Pool.h"
+#include "../inc/LLFifo.h"
+
+// the firmware gets these from CortexM.c
+long StartCritical(void){ return 0; }
+void EndCritical(long sr){ (void)sr; }
+
+#define ROUNDS   200000
+#define BURST    32         // items or messages queued before draining
+#define MSGSIZE  24         // bytes in one message
+#define DEPTH    64         // queue capacity (power of 2 for FIFO.h)
+
+AddIndexFifo(Word, DEPTH, int32_t, 1, 0)
+AddIndexFifo(Byte, DEPTH*MSGSIZE, uint8_t, 1, 0)
+typedef struct{ uint8_t data[MSGSIZE]; } Msg_t;
+AddIndexFifo(Msg, DEPTH, Msg_t, 1, 0)
+AddPool(Bench, LLFIFO_BLOCK(MSGSIZE), DEPTH)
+
+static volatile uint32_t Sink;   // keeps the reads from being optimized out
+
+static double now(void){
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec*1e9 + t.tv_nsec;
+}
+
+static void report(const char *name, double start, uint32_t bytes){
+  double ns = (now() - start)/((double)ROUNDS*BURST);
+  printf("%-36s %7.2f ns/op %6u bytes\n", name, ns, bytes);
+}
+
+int main(void){
+  LLFifo_t q;
+  uint8_t msg[MSGSIZE], out[MSGSIZE];
+  uint32_t r, i, size;
+  int32_t w;
+  double t;
+  memset(msg, 0x5A, sizeof(msg));
+
+  printf("%u rounds of %u puts then %u gets\n", ROUNDS, BURST, BURST);
+  printf("-- 32-bit words\n");
+  WordFifo_Init();
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < BURST; i++) WordFifo_Put(i);
+    for(i = 0; i < BURST; i++){ WordFifo_Get(&w); Sink += w; }
+  }
+  report("index FIFO Put/Get", t, sizeof(int32_t)*DEPTH);
+
+  BenchPool_Init();
+  LLFifo_Init(&q, &BenchPool);
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < BURST; i++){ w = i; LLFifo_Put(&q, &w, sizeof(w)); }
+    for(i = 0; i < BURST; i++){
+      size = sizeof(w);
+      LLFifo_Get(&q, &w, &size);
+      Sink += w;
+    }
+  }
+  report("linked queue Put/Get", t, POOL_BLOCK(LLFIFO_BLOCK(MSGSIZE))*DEPTH);
+
+  printf("-- %u-byte messages\n", MSGSIZE);
+  ByteFifo_Init();
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < BURST; i++) ByteFifo_PutN(msg, MSGSIZE);
+    for(i = 0; i < BURST; i++){ ByteFifo_GetN(out, MSGSIZE); Sink += out[0]; }
+  }
+  report("index byte FIFO PutN/GetN", t, DEPTH*MSGSIZE);
+
+  MsgFifo_Init();
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    Msg_t m;
+    for(i = 0; i < BURST; i++){ memcpy(m.data, msg, MSGSIZE); MsgFifo_Put(m); }
+    for(i = 0; i < BURST; i++){ MsgFifo_Get(&m); Sink += m.data[0]; }
+  }
+  report("index FIFO of structs Put/Get", t, sizeof(Msg_t)*DEPTH);
+
+  BenchPool_Init();
+  LLFifo_Init(&q, &BenchPool);
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < BURST; i++) LLFifo_Put(&q, msg, MSGSIZE);
+    for(i = 0; i < BURST; i++){
+      size = MSGSIZE;
+      LLFifo_Get(&q, out, &size);
+      Sink += out[0];
+    }
+  }
+  report("linked queue Put/Get (copy)", t, POOL_BLOCK(LLFIFO_BLOCK(MSGSIZE))*DEPTH);
+
+  t = now();
+  for(r = 0; r < ROUNDS; r++){
+    for(i = 0; i < BURST; i++){
+      uint8_t *pt = LLFifo_Reserve(&q, MSGSIZE);
+      pt[0] = i;                        // build the message in place
+      LLFifo_Commit(&q, pt);
+    }
+    for(i = 0; i < BURST; i++){
+      uint8_t *pt = LLFifo_Peek(&q, &size);
+      Sink += pt[0];                    // decode it in place
+      LLFifo_Release(&q);
+    }
+  }
+  report("linked queue Reserve/Peek (in place)", t, POOL_BLOCK(LLFIFO_BLOCK(MSGSIZE))*DEPTH);
+
+  printf("pool low-water %u of %u blocks, %u failed allocations\n",
+         BenchPool.minFree, BenchPool.count, BenchPool.fails);
+  return 0;
+}
@@ -0,0 +1,216 @@
+// fwhost.c
+// Runs on the host (Linux)
+// Runs the BLE contact tracing firmware (TM4C/main.c and everything it
+// calls) on a PC against the simulated peripherals of hostsim.c, with a
+// model of the BGM220 NCP on UART1 and the ST7735 of tools/st7735emu on
+// SSI0.  Build from the repository root with
+//   gcc -std=gnu99 -g -O1 -fsanitize=address,undefined -o fwhost
+//       -include tools/hostsim/mock.h -DST7735_DMA=0 -DUART0_STDIO=0
+//       TM4C/main.c TM4C/BLEHandler.c TM4C/AppHandler.c TM4C/Display.c
+//       TM4C/Dashboard.c TM4C/Scheduler.c TM4C/Timer.c TM4C/Switch.c
+//       TM4C/Log.c
+//       TM4C/BGLib/sl_bt_ncp_host.c TM4C/BGLib/sl_bt_ncp_host_api.c
+//       TM4C/BGLib/sl_bt_ncp_trace.c inc/UART1int.c inc/UART0int.c
+//       inc/ST7735.c inc/ST7735Dev.c inc/Clock.c inc/FIFOStats.c inc/Probe.c
+//       tools/st7735emu/st7735emu.c tools/hostsim/hostsim.c
+//       tools/hostsim/fwhost.c
+// (-O2 without the sanitizers to benchmark; add -DPROBE_ENABLE=1 for
+// the Probe.h histograms in simulated cycles, and -DHOSTSIM_HOSTCYCCNT=1
+// for them in host time; -pg or perf for a profile), then
+//   ./fwhost [-t ms] [-r reports/s] [-c ms] [-s file.png|.ppm] [-d] [-l file]
+//   -t  simulated time to run, default 10000 ms
+//   -r  scanner reports the NCP sends per second, default 0 (main.c does
+//       not start the scanner)
+//   -c  open and close a connection every ms milliseconds, default 0
+//   -s  save what the panel shows at the end
+//   -d  BLEHandler_StatsDump at the end (UART0 goes to stdout)
+//   -l  write the message log (Log_Dump) to a file at the end, for
+//       tools/log_decode.py
+// At the end it prints the simulated and host time, UART1 traffic and
+// interrupt counts on stderr.
+//
+// The NCP model answers every BGAPI command with result 0 (followed by
+// zeros for any other response fields), sends system_boot 20 ms after
+// system_reset, and ignores anything that is not a BGAPI command.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../TM4C/BGLib/sl_bt_api.h"
+#include "../../TM4C/BLEHandler.h"
+#include "../../TM4C/Log.h"
+#include "../st7735emu/st7735emu.h"
+#include "hostsim.h"
+#undef main
+
+#define FW_HZ     80000000u         // main.c runs Clock_InitFastest first
+#define MS(n)     ((uint64_t)(n)*(FW_HZ/1000))
+#define RSP_ZEROS 8                 // zeros after the result of a response
+
+int Firmware_Main(void);
+
+static uint32_t ReportsPerSec, ConnectMs;
+static const char *Snapshot, *LogFile;
+static FILE *LogOut;
+static int Dump;
+static struct timespec HostStart;
+
+//********** NCP model **********
+
+static uint8_t Frame[4 + 2048];     // command being received
+static uint32_t FrameN;
+static uint32_t Reports, Connected;
+
+// send one BGAPI message, header as in sl_bt_host_command
+static void ncpSend(uint32_t id, const uint8_t *payload, uint32_t len){
+  uint32_t header = id + ((len&0xff)<<8) + ((len&0x700)>>8);
+  uint8_t hdr[4];
+  hdr[0] = header; hdr[1] = header>>8; hdr[2] = header>>16; hdr[3] = header>>24;
+  HostSim_UART1Send(hdr, 4);
+  HostSim_UART1Send(payload, len);
+}
+
+static void ncpBoot(void){
+  uint8_t boot[sizeof(struct sl_bt_evt_system_boot_s)];
+  memset(boot, 0, sizeof(boot));
+  boot[0] = 3;                      // version 3.1
+  boot[2] = 1;
+  ncpSend(sl_bt_evt_system_boot_id, boot, sizeof(boot));
+}
+
+// one advertisement that BLEHandler's validBLE accepts, 64 different
+// senders, so contacts are both new and known
+static void ncpReport(void){
+  uint8_t evt[17 + 1 + 18];
+  uint8_t *data = &evt[18];
+  uint32_t n = Reports++;
+  memset(evt, 0, sizeof(evt));
+  evt[1] = n%64;                    // address
+  evt[14] = (uint8_t)(-30 - (int)(n%25)); // rssi
+  evt[17] = 18;                     // data.len
+  memcpy(data, "\x02\x01\x06\x05\xFF\xFF\x02\x00\xFF\x07\x08", 11);
+  snprintf((char *)&data[11], 7, "Tag%03u", (unsigned)(n%64));
+  data[17] = n%64;
+  ncpSend(sl_bt_evt_scanner_scan_report_id, evt, sizeof(evt));
+  HostSim_Schedule(FW_HZ/ReportsPerSec, &ncpReport);
+}
+
+static void ncpConnection(void){
+  uint8_t evt[sizeof(struct sl_bt_evt_connection_opened_s)];
+  memset(evt, 0, sizeof(evt));
+  if(Connected){
+    ncpSend(sl_bt_evt_connection_closed_id, evt, sizeof(struct sl_bt_evt_connection_closed_s));
+  } else{
+    ncpSend(sl_bt_evt_connection_opened_id, evt, sizeof(evt));
+  }
+  Connected = !Connected;
+  HostSim_Schedule(MS(ConnectMs), &ncpConnection);
+}
+
+// a byte from the firmware; a command is answered once all of it is in
+static void ncpRx(uint8_t data){
+  uint32_t len, id;
+  uint8_t rsp[2 + RSP_ZEROS];
+  Frame[FrameN++] = data;
+  if((Frame[0]&0xF8) != sl_bt_dev_type_default){
+    FrameN = 0;                     // not a command, resync
+    return;
+  }
+  if(FrameN < 4){
+    return;
+  }
+  len = ((Frame[0]&0x07)<<8)|Frame[1];
+  if(FrameN < 4 + len){
+    return;
+  }
+  FrameN = 0;
+  id = (Frame[0]|(Frame[1]<<8)|(Frame[2]<<16)|((uint32_t)Frame[3]<<24))&0xffff00f8;
+  if(id == sl_bt_cmd_system_reset_id){
+    HostSim_Schedule(MS(20), &ncpBoot);
+    if(ReportsPerSec){
+      HostSim_Schedule(MS(100), &ncpReport);
+    }
+    if(ConnectMs){
+      HostSim_Schedule(MS(ConnectMs), &ncpConnection);
+    }
+    return;
+  }
+  memset(rsp, 0, sizeof(rsp));      // result SL_STATUS_OK
+  ncpSend(id, rsp, sizeof(rsp));
+}
+
+//********** host main **********
+
+static void logOut(char data){
+  fwrite(&data, 1, 1, LogOut);      // mock.h renames fputc for ST7735.c
+}
+
+static void stop(void){
+  const HostSimStats_t *st;
+  struct timespec now;
+  double host, sim = (double)HostSim_Now()/FW_HZ;
+  if(Dump){
+    BLEHandler_StatsDump();
+  }
+  st = HostSim_Stats();
+  fflush(stdout);
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  host = (now.tv_sec - HostStart.tv_sec) + (now.tv_nsec - HostStart.tv_nsec)*1e-9;
+  fprintf(stderr, "simulated %.3f s in %.3f s (%.1fx)\n", sim, host, sim/host);
+  fprintf(stderr, "uart1 tx %llu rx %llu bytes, %u overruns, %u tx dropped\n",
+          (unsigned long long)st->uart1TxBytes, (unsigned long long)st->uart1RxBytes,
+          st->uart1Overruns, st->uart1TxDropped);
+  fprintf(stderr, "interrupts uart1 %u timer0a %u gpiof %u, asleep %.1f%%\n",
+          st->irqs[6], st->irqs[19], st->irqs[30], 100.0*st->sleep/HostSim_Now());
+  if(LogFile){
+    if((LogOut = fopen(LogFile, "wb")) == 0){
+      fprintf(stderr, "cannot write %s\n", LogFile);
+      exit(1);
+    }
+    Log_Dump(&logOut);
+    fclose(LogOut);
+  }
+  if(Snapshot){
+    int n = strlen(Snapshot);
+    if(((n > 4) && (strcmp(&Snapshot[n-4], ".ppm") == 0))?
+       ST7735Emu_WritePPM(Snapshot): ST7735Emu_WritePNG(Snapshot)){
+      fprintf(stderr, "cannot write %s\n", Snapshot);
+      exit(1);
+    }
+  }
+  exit(0);
+}
+
+int main(int argc, char **argv){
+  uint32_t ms = 10000;
+  int i;
+  for(i = 1; i < argc; i++){
+    if((strcmp(argv[i], "-t") == 0) && (i+1 < argc)){
+      ms = strtoul(argv[++i], 0, 0);
+    } else if((strcmp(argv[i], "-r") == 0) && (i+1 < argc)){
+      ReportsPerSec = strtoul(argv[++i], 0, 0);
+    } else if((strcmp(argv[i], "-c") == 0) && (i+1 < argc)){
+      ConnectMs = strtoul(argv[++i], 0, 0);
+    } else if((strcmp(argv[i], "-s") == 0) && (i+1 < argc)){
+      Snapshot = argv[++i];
+    } else if(strcmp(argv[i], "-d") == 0){
+      Dump = 1;
+    } else if((strcmp(argv[i], "-l") == 0) && (i+1 < argc)){
+      LogFile = argv[++i];
+    } else{
+      fprintf(stderr, "usage: %s [-t ms] [-r reports/s] [-c ms] [-s file.png|.ppm] [-d] [-l file]\n", argv[0]);
+      return 2;
+    }
+  }
+  if(HostSim_Init()){
+    fprintf(stderr, "cannot map the peripheral space at 0x40000000\n");
+    return 1;
+  }
+  HostSim_UART1Peer(&ncpRx);
+  HostSim_SetEnd(MS(ms), &stop);
+  clock_gettime(CLOCK_MONOTONIC, &HostStart);
+  Firmware_Main();
+  return 0;
+}
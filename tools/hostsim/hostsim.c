@@ -0,0 +1,675 @@
+// hostsim.c
+// Runs on the host (Linux)
+// Simulated TM4C123 peripherals, NVIC and the Cortex-M functions of
+// CortexM.c, see hostsim.h.  Every model keeps the time of the next
+// thing it has to do (a byte leaves the shift register, a byte arrives,
+// the timer times out); advanceTo runs them in time order up to a point.
+// Firmware register writes are noticed at the next sync point (syncAll):
+// ICR bits clear RIS, NVIC enable bits are set, a timer that was enabled
+// starts counting.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/time.h>
+#include "../../inc/tm4c123gh6pm.h"
+#include "../../inc/CortexM.h"
+#include "../../inc/Clock.h"
+#include "../st7735emu/st7735emu.h"
+#include "hostsim.h"
+
+// registers that mock.h turns into calls, at their own addresses
+#define REG(a)      (*((volatile uint32_t *)(uintptr_t)(a)))
+#define U1DR        REG(0x4000D000)
+#define U1FR        REG(0x4000D018)
+#define U1RIS       REG(0x4000D03C)
+#define U1MIS       REG(0x4000D040)
+#define U0DR        REG(0x4000C000)
+#define U0FR        REG(0x4000C018)
+#define GPIOF_BASE  0x40025000u    // DATA aliases at 0x000-0x3FC
+
+#define IRQ_UART1   6
+#define IRQ_TIMER0A 19
+#define IRQ_GPIOF   30
+#define THREAD      256            // priority of the main program
+#define NEVER       UINT64_MAX
+#define DR_READ     0x80000000u    // left in a data register until written
+#define DR_UNTOUCHED(dr) (((dr)&0xFFFFFF00u) == DR_READ) // a char -1 is written
+#define UFIFO       16             // hardware FIFO depth
+#define PEERQ       65536          // bytes queued by the UART1 peer
+#define SCHEDS      16
+#ifndef HOSTSIM_HOSTCYCCNT
+#define HOSTSIM_HOSTCYCCNT 0       // 1: DWTCYCCNT counts host time
+#endif
+
+uint8_t HostSim_Scs[0x100000];     // 0xE0000000-0xE00FFFFF, see scs.h
+
+static volatile uint64_t Now;      // simulated cycles
+static uint64_t End = NEVER;
+static void (*Stop)(void);
+static volatile int Primask;
+static int Running = THREAD;       // priority of what the CPU runs
+static volatile sig_atomic_t InSim; // model state is being changed
+static uint32_t Armed;             // data registers handed out, see resolve
+static uint32_t Enabled[5];        // NVIC interrupt enables
+static HostSimStats_t Stats;
+
+static struct{
+  uint64_t at;                     // NEVER when free
+  void (*fn)(void);
+} Sched[SCHEDS];
+
+// UART1
+static uint8_t U1Tx[UFIFO], U1Rx[UFIFO];
+static uint32_t U1TxR, U1TxN, U1RxR, U1RxN;
+static uint64_t TxAt = NEVER;      // stop bit of the byte being sent
+static uint8_t TxShift;
+static uint64_t RxAt = NEVER;      // next byte from the peer arrives
+static uint64_t RtAt = NEVER;      // receive time-out
+static void (*Peer)(uint8_t data);
+static uint8_t PeerQ[PEERQ];
+static uint32_t PeerR, PeerN;
+
+// Timer0A
+static uint64_t T0At = NEVER;      // next time-out
+
+// GPIOF
+static uint32_t PinIn;             // levels driven by HostSim_SetPin
+static uint32_t PinOut;            // levels written by the firmware
+static uint32_t PinShown;          // what the DATA aliases hold
+
+// SSI0
+static uint32_t SsiBytes;          // st7735emu bytes already timed
+
+extern void UART1_Handler(void) __attribute__((weak));
+extern void Timer0A_Handler(void) __attribute__((weak));
+extern void GPIOPortF_Handler(void) __attribute__((weak));
+static const struct{
+  uint32_t irq;
+  void (*handler)(void);
+} Vectors[] = {
+  {IRQ_UART1, UART1_Handler},
+  {IRQ_TIMER0A, Timer0A_Handler},
+  {IRQ_GPIOF, GPIOPortF_Handler}
+};
+#define VECTORS (sizeof(Vectors)/sizeof(Vectors[0]))
+
+static void advanceTo(uint64_t t);
+static int dispatch(void);
+
+//********** UART1 **********
+
+// cycles per 10-bit character at the rate in IBRD/FBRD
+static uint64_t byteTime(void){
+  uint64_t div64 = UART1_IBRD_R*64 + UART1_FBRD_R;
+  uint64_t t = (UART1_CTL_R&UART_CTL_HSE)? div64*80/64: div64*160/64;
+  return t? t: 1;
+}
+
+// FIFO levels for the IFLS fields: 1/8, 1/4, 1/2, 3/4, 7/8 of 16
+static uint32_t level(uint32_t field){
+  static const uint32_t levels[8] = {2, 4, 8, 12, 14, 14, 14, 14};
+  return levels[field&7];
+}
+#define TXLEVEL level(UART1_IFLS_R)
+#define RXLEVEL level(UART1_IFLS_R>>3)
+
+static void u1Flags(void){
+  uint32_t fr = 0;
+  if(U1RxN == 0)     fr |= UART_FR_RXFE;
+  if(U1RxN == UFIFO) fr |= UART_FR_RXFF;
+  if(U1TxN == 0)     fr |= UART_FR_TXFE;
+  if(U1TxN == UFIFO) fr |= UART_FR_TXFF;
+  if(U1TxN || (TxAt != NEVER)) fr |= UART_FR_BUSY;
+  U1FR = fr;
+  U1MIS = U1RIS&UART1_IM_R;
+}
+
+// move the next byte of the TX FIFO into the shift register
+static void u1TxStart(uint64_t start){
+  TxShift = U1Tx[U1TxR];
+  U1TxR = (U1TxR + 1)%UFIFO;
+  U1TxN--;
+  TxAt = start + byteTime();
+  if(U1TxN <= TXLEVEL){
+    U1RIS |= UART_RIS_TXRIS;
+  }
+}
+
+static void u1Write(uint8_t data){
+  if(U1TxN == UFIFO){
+    Stats.uart1TxDropped++;
+    return;
+  }
+  U1Tx[(U1TxR + U1TxN)%UFIFO] = data;
+  U1TxN++;
+  if(U1TxN > TXLEVEL){
+    U1RIS &= ~UART_RIS_TXRIS;
+  }
+  if(TxAt == NEVER){
+    u1TxStart(Now);
+  }
+}
+
+static void u1Read(void){
+  if(U1RxN){
+    U1RxR = (U1RxR + 1)%UFIFO;
+    U1RxN--;
+    if(U1RxN < RXLEVEL){
+      U1RIS &= ~UART_RIS_RXRIS;
+    }
+    if(U1RxN == 0){
+      U1RIS &= ~UART_RIS_RTRIS;
+    }
+  }
+}
+
+static void u1TxEvent(void){
+  uint8_t sent = TxShift;
+  Stats.uart1TxBytes++;
+  TxAt = NEVER;
+  if(U1TxN){
+    u1TxStart(Now);
+  }
+  if(Peer){
+    Peer(sent);
+  }
+}
+
+static void u1RxEvent(void){
+  uint32_t on = UART_CTL_UARTEN|UART_CTL_RXE;
+  RxAt = Now + byteTime();
+  if(((UART1_CTL_R&on) != on) ||
+     ((UART1_CTL_R&UART_CTL_RTSEN) && (U1RxN == UFIFO))){
+    return;                         // peer holds the byte
+  }
+  if(U1RxN == UFIFO){
+    Stats.uart1Overruns++;
+    U1RIS |= UART_RIS_OERIS;
+  } else{
+    U1Rx[(U1RxR + U1RxN)%UFIFO] = PeerQ[PeerR];
+    U1RxN++;
+    if(U1RxN >= RXLEVEL){
+      U1RIS |= UART_RIS_RXRIS;
+    }
+  }
+  Stats.uart1RxBytes++;
+  PeerR = (PeerR + 1)%PEERQ;
+  PeerN--;
+  RtAt = Now + byteTime()*32/10;    // 32 bit times
+  if(PeerN == 0){
+    RxAt = NEVER;
+  }
+}
+
+static void u1RtEvent(void){
+  RtAt = NEVER;
+  if(U1RxN){
+    U1RIS |= UART_RIS_RTRIS;
+  }
+}
+
+// A data register was handed out with DR_READ in it: if that is still
+// there the firmware read it, else it wrote a byte.  Done before the
+// next access, so reads and writes are taken in order.
+static void resolve(void){
+  uint32_t dr;
+  if(Armed&0x02){
+    dr = U1DR;
+    if(DR_UNTOUCHED(dr)){
+      u1Read();
+    } else{
+      u1Write(dr);
+    }
+  }
+  if(Armed&0x01){
+    dr = U0DR;
+    if(!DR_UNTOUCHED(dr)){
+      putchar(dr&0xFF);
+    }
+  }
+  Armed = 0;
+}
+
+//********** GPIOF **********
+
+static uint32_t pinLevels(void){
+  uint32_t dir = GPIO_PORTF_DIR_R;
+  return ((PinIn&~dir)|(PinOut&dir))&0xFF;
+}
+
+// outputs the firmware wrote through any DATA alias since the last call
+static void gpiofReadAliases(void){
+  uint32_t m, v;
+  for(m = 1; m < 256; m++){
+    v = REG(GPIOF_BASE + 4*m)&m;
+    if(v != (PinShown&m)){
+      PinOut = (PinOut&~m)|v;
+    }
+  }
+}
+
+static void gpiofWriteAliases(void){
+  uint32_t m;
+  PinShown = pinLevels();
+  for(m = 0; m < 256; m++){
+    REG(GPIOF_BASE + 4*m) = PinShown&m;
+  }
+}
+
+//********** all models **********
+
+static void nvicSync(void){
+  uint32_t i, v;
+  for(i = 0; i < 5; i++){
+    if((v = HOSTSIM_SCS(0xE000E100 + 4*i))){
+      Enabled[i] |= v;
+      HOSTSIM_SCS(0xE000E100 + 4*i) = 0;
+    }
+    if((v = HOSTSIM_SCS(0xE000E180 + 4*i))){
+      Enabled[i] &= ~v;
+      HOSTSIM_SCS(0xE000E180 + 4*i) = 0;
+    }
+  }
+}
+
+// take in what the firmware wrote since the last call
+static void syncAll(void){
+  uint32_t v;
+  resolve();
+  nvicSync();
+  if((v = UART1_ICR_R)){
+    U1RIS &= ~v;
+    UART1_ICR_R = 0;
+  }
+  u1Flags();
+  if((v = TIMER0_ICR_R)){
+    TIMER0_RIS_R &= ~v;
+    TIMER0_ICR_R = 0;
+  }
+  if(TIMER0_CTL_R&TIMER_CTL_TAEN){
+    if(T0At == NEVER){
+      T0At = Now + (uint64_t)TIMER0_TAILR_R + 1;
+    }
+  } else{
+    T0At = NEVER;
+  }
+  TIMER0_MIS_R = TIMER0_RIS_R&TIMER0_IMR_R;
+  if((v = GPIO_PORTF_ICR_R)){
+    GPIO_PORTF_RIS_R &= ~v;
+    GPIO_PORTF_ICR_R = 0;
+  }
+  v = GPIO_PORTF_IS_R&~(PinIn^GPIO_PORTF_IEV_R)&0xFF;
+  GPIO_PORTF_RIS_R |= v;            // level-sensitive pins at their level
+  GPIO_PORTF_MIS_R = GPIO_PORTF_RIS_R&GPIO_PORTF_IM_R;
+}
+
+static uint64_t nextEvent(void){
+  uint64_t t = TxAt;
+  int i;
+  if(RxAt < t) t = RxAt;
+  if(RtAt < t) t = RtAt;
+  if(T0At < t) t = T0At;
+  for(i = 0; i < SCHEDS; i++){
+    if(Sched[i].at < t) t = Sched[i].at;
+  }
+  return t;
+}
+
+// run the models up to time t, or stop at End
+static void advanceTo(uint64_t t){
+  uint64_t next;
+  int i;
+  if(t > End){
+    t = End;
+  }
+  while((next = nextEvent()) <= t){
+    Now = next;
+    if(TxAt == Now) u1TxEvent();
+    if(RxAt == Now) u1RxEvent();
+    if(RtAt == Now) u1RtEvent();
+    if(T0At == Now){
+      TIMER0_RIS_R |= TIMER_RIS_TATORIS;
+      if((TIMER0_TAMR_R&TIMER_TAMR_TAMR_M) == TIMER_TAMR_TAMR_PERIOD){
+        T0At = Now + (uint64_t)TIMER0_TAILR_R + 1;
+      } else{
+        T0At = NEVER;               // one-shot
+        TIMER0_CTL_R &= ~TIMER_CTL_TAEN;
+      }
+    }
+    for(i = 0; i < SCHEDS; i++){
+      if(Sched[i].at == Now){
+        Sched[i].at = NEVER;
+        Sched[i].fn();
+      }
+    }
+  }
+  Now = t;
+  if(Now >= End){
+    End = NEVER;                    // the stop function may still use the models
+    Stop();
+    fprintf(stderr, "hostsim: stop function returned\n");
+    exit(1);
+  }
+}
+
+static uint32_t priority(uint32_t irq){
+  return HostSim_Scs[0xE400 + irq]>>5;
+}
+
+// index in Vectors of the interrupt to take now, -1 for none
+static int pending(void){
+  uint32_t i, irq, p, best = Running;
+  int n = -1, asserted;
+  for(i = 0; i < VECTORS; i++){
+    irq = Vectors[i].irq;
+    switch(irq){
+      case IRQ_UART1:   asserted = U1MIS != 0; break;
+      case IRQ_TIMER0A: asserted = TIMER0_MIS_R != 0; break;
+      default:          asserted = GPIO_PORTF_MIS_R != 0; break;
+    }
+    if(asserted && (Enabled[irq>>5]&(1u<<(irq&31))) && Vectors[i].handler &&
+       ((p = priority(irq)) < best)){
+      best = p;
+      n = i;
+    }
+  }
+  return n;
+}
+
+// take every interrupt that can preempt what is running
+// returns the number of handlers run
+static int dispatch(void){
+  int n, count = 0, running;
+  sig_atomic_t insim;
+  syncAll();
+  while(!Primask && ((n = pending()) >= 0)){
+    running = Running;
+    Running = priority(Vectors[n].irq);
+    Stats.irqs[Vectors[n].irq]++;
+    insim = InSim;
+    InSim = 0;                      // a higher priority may preempt it
+    Vectors[n].handler();
+    InSim = insim;
+    Running = running;
+    count++;
+    syncAll();
+  }
+  return count;
+}
+
+// firmware time passes: models run, interrupts are taken on the way
+static void step(uint64_t cycles){
+  uint64_t target = Now + cycles, t;
+  do{
+    t = nextEvent();
+    advanceTo((t < target)? t: target);
+    dispatch();
+  } while(Now < target);
+}
+
+// The CPU is stuck in a loop that waits for an ISR: skip to what happens
+// next, until an interrupt has been taken or 1 ms has gone by.
+static void tick(int sig){
+  uint64_t limit, t;
+  (void)sig;
+  if(InSim || Armed || Primask){
+    return;                         // try again at the next tick
+  }
+  InSim = 1;
+  limit = Now + HostSim_Us(1000);
+  do{
+    t = nextEvent();
+    advanceTo((t < limit)? t: limit);
+  } while((dispatch() == 0) && (Now < limit));
+  InSim = 0;
+}
+
+//********** registers that are calls **********
+
+volatile uint32_t *HostSim_UART1Reg(volatile uint32_t *reg){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  syncAll();                        // the access before this one first
+  step(HOSTSIM_ACCESS);
+  if(reg == &U1DR){
+    U1DR = DR_READ|(U1RxN? U1Rx[U1RxR]: 0);
+    Armed |= 0x02;
+  }
+  InSim = insim;
+  return reg;
+}
+
+volatile uint32_t *HostSim_UART0Reg(volatile uint32_t *reg){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  syncAll();
+  step(HOSTSIM_ACCESS);
+  U0FR = UART_FR_TXFE|UART_FR_RXFE;
+  if(reg == &U0DR){
+    U0DR = DR_READ;
+    Armed |= 0x01;
+  }
+  InSim = insim;
+  return reg;
+}
+
+volatile uint32_t *HostSim_SSI0SR(void){
+  sig_atomic_t insim = InSim;
+  volatile uint32_t *sr;
+  uint32_t bytes, bitTime;
+  InSim = 1;
+  sr = ST7735Emu_SSI0SR();          // hands a written byte to the panel
+  bytes = ST7735Emu_Counts()->bytes;
+  if(bytes < SsiBytes){
+    SsiBytes = 0;                   // counts were cleared
+  }
+  bitTime = (SSI0_CPSR_R&0xFF)*(((SSI0_CR0_R>>8)&0xFF) + 1);
+  step(HOSTSIM_ACCESS + (uint64_t)(bytes - SsiBytes)*8*bitTime);
+  SsiBytes = bytes;
+  InSim = insim;
+  return sr;
+}
+
+volatile uint32_t *HostSim_NvicWrite(uint32_t addr){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  nvicSync();                       // the write before this one
+  InSim = insim;
+  return &HOSTSIM_SCS(addr);
+}
+
+// the cycle count DWTCYCCNT follows: simulated time, or with
+// HOSTSIM_HOSTCYCCNT=1 host time in cycles of the firmware clock
+static uint64_t cycles(void){
+#if HOSTSIM_HOSTCYCCNT
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec)*
+         (Clock_GetFreq()/1000000)/1000;
+#else
+  return Now;
+#endif
+}
+
+// If the value handed out last time is no longer there, the firmware
+// wrote the counter at that time; it counts on from what was written.
+volatile uint32_t *HostSim_CycCnt(void){
+  static uint32_t cyccnt, shown, offset;
+  static uint64_t at;
+  if(cyccnt != shown){
+    offset = cyccnt - (uint32_t)at;
+  }
+  at = cycles();
+  cyccnt = shown = (uint32_t)at + offset;
+  return &cyccnt;
+}
+
+//********** CortexM.c **********
+
+void DisableInterrupts(void){
+  Primask = 1;
+}
+
+void EnableInterrupts(void){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  Primask = 0;
+  dispatch();
+  InSim = insim;
+}
+
+long StartCritical(void){
+  long sr = Primask;
+  Primask = 1;
+  return sr;
+}
+
+void EndCritical(long sr){
+  if(sr == 0){
+    EnableInterrupts();
+  }
+}
+
+// sleep until an interrupt that can preempt is pending; with PRIMASK
+// set it is taken at EnableInterrupts/EndCritical, as on the Cortex-M
+void WaitForInterrupt(void){
+  sig_atomic_t insim = InSim;
+  uint64_t start = Now, t;
+  InSim = 1;
+  syncAll();
+  while(pending() < 0){
+    t = nextEvent();
+    if((t == NEVER) && (End == NEVER)){
+      fprintf(stderr, "hostsim: WaitForInterrupt with nothing left to happen\n");
+      exit(1);
+    }
+    advanceTo(t);
+    syncAll();
+  }
+  Stats.sleep += Now - start;
+  dispatch();
+  InSim = insim;
+}
+
+void Clock_Delay(uint32_t ulCount){
+  HostSim_Advance((uint64_t)ulCount*80000/23746); // 23746 per ms at 80 MHz
+}
+
+void Clock_Delay1ms(uint32_t n){
+  HostSim_Advance(n*HostSim_Us(1000));
+}
+
+//********** hostsim.h **********
+
+int HostSim_Init(void){
+  struct sigaction sa;
+  struct itimerval it;
+  uint32_t a;
+  int i;
+  if(ST7735Emu_Init()){             // maps 0x40000000-0x400FFFFF
+    return -1;
+  }
+  memset(HostSim_Scs, 0, sizeof(HostSim_Scs));
+  for(a = 0x400FEA00; a < 0x400FEA60; a += 4){
+    REG(a) = 0xFFFFFFFF;            // every peripheral reports ready
+  }
+  SYSCTL_RIS_R = SYSCTL_RIS_PLLLRIS;// the PLL locks at once
+  Now = 0;
+  Primask = 0;                      // as out of reset
+  Running = THREAD;
+  for(i = 0; i < SCHEDS; i++){
+    Sched[i].at = NEVER;
+  }
+  memset(&Stats, 0, sizeof(Stats));
+  u1Flags();
+  U0FR = UART_FR_TXFE|UART_FR_RXFE;
+  gpiofWriteAliases();
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = &tick;
+  sigaction(SIGALRM, &sa, 0);
+  it.it_interval.tv_sec = 0;
+  it.it_interval.tv_usec = 250;
+  it.it_value = it.it_interval;
+  setitimer(ITIMER_REAL, &it, 0);
+  return 0;
+}
+
+uint64_t HostSim_Now(void){
+  return Now;
+}
+
+uint64_t HostSim_Us(uint32_t us){
+  return (uint64_t)us*Clock_GetFreq()/1000000;
+}
+
+void HostSim_Advance(uint64_t cycles){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  syncAll();
+  step(cycles);
+  InSim = insim;
+}
+
+void HostSim_SetEnd(uint64_t end, void (*stop)(void)){
+  End = end;
+  Stop = stop;
+}
+
+int HostSim_Schedule(uint64_t delay, void (*fn)(void)){
+  int i;
+  for(i = 0; i < SCHEDS; i++){
+    if(Sched[i].at == NEVER){
+      Sched[i].fn = fn;
+      Sched[i].at = Now + delay;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+void HostSim_UART1Peer(void (*rx)(uint8_t data)){
+  Peer = rx;
+}
+
+uint32_t HostSim_UART1Send(const uint8_t *data, uint32_t len){
+  uint32_t n;
+  for(n = 0; (n < len) && (PeerN < PEERQ); n++){
+    PeerQ[(PeerR + PeerN)%PEERQ] = data[n];
+    PeerN++;
+  }
+  if(n && (RxAt == NEVER)){
+    RxAt = Now + byteTime();
+  }
+  return n;
+}
+
+void HostSim_SetPin(uint32_t pin, uint32_t level){
+  uint32_t bit = 1u<<pin, old = PinIn, edge;
+  gpiofReadAliases();
+  PinIn = level? (PinIn|bit): (PinIn&~bit);
+  if((old^PinIn)&bit&~GPIO_PORTF_IS_R){
+    edge = level? GPIO_PORTF_IEV_R: ~GPIO_PORTF_IEV_R;
+    if((GPIO_PORTF_IBE_R|edge)&bit){
+      GPIO_PORTF_RIS_R |= bit;
+    }
+  }
+  gpiofWriteAliases();
+}
+
+uint32_t HostSim_GetPins(void){
+  gpiofReadAliases();
+  gpiofWriteAliases();
+  return PinShown;
+}
+
+const HostSimStats_t *HostSim_Stats(void){
+  sig_atomic_t insim = InSim;
+  InSim = 1;
+  resolve();                        // the last byte written to a DR
+  InSim = insim;
+  return &Stats;
+}
@@ -0,0 +1,120 @@
+// hostsim.h
+// Runs on the host (Linux)
+// Simulated TM4C123 peripherals for running the firmware off-target: the
+// sources in TM4C/ and inc/ are compiled unchanged for Linux with
+// -include tools/hostsim/mock.h, linked with hostsim.c (in place of
+// CortexM.c and the startup file) and tools/st7735emu/st7735emu.c, and
+// can then be built with sanitizers, debugged and profiled on a PC.
+// fwhost.c is the host main for the BLE firmware, with the build line.
+//
+// Time is simulated, in CPU cycles at Clock_GetFreq().  Firmware code
+// between two register accesses takes no simulated time; each access to
+// a modelled register takes HOSTSIM_ACCESS cycles, Clock_Delay and
+// WaitForInterrupt skip ahead to the next thing the models have to do.
+// Interrupts are taken at those points, like a real interrupt between
+// two instructions: when PRIMASK is clear and the handler's NVIC
+// priority is higher than what is running.  A spin loop that waits for
+// an ISR without touching a register (UART1_OutChar with a full software
+// FIFO) is let through by a 250 us host timer, which runs the models
+// from a signal handler as the NVIC would.
+//
+// Models
+//   UART1   16-byte hardware FIFOs at the baud rate set in IBRD/FBRD,
+//           RX/TX level and receive time-out interrupts (IFLS, IM, RIS,
+//           MIS, ICR), RTS flow control; the far end is a HostSim peer
+//   UART0   transmit only, bytes go to stdout at once (trace dumps); the
+//           TX FIFO never fills, so UART0int.c writes straight through
+//           and its interrupt is not modelled
+//   SSI0    tools/st7735emu (ST7735 panel), one byte every 8 SSI clocks
+//           (CPSR, SCR); no SSI interrupts, the driver polls
+//   Timer0A 32-bit periodic and one-shot time-out interrupts
+//   GPIOF   inputs set with HostSim_SetPin, edge and level interrupts
+//           (IS, IBE, IEV, IM, RIS, MIS, ICR); outputs read back with
+//           HostSim_GetPins
+//   NVIC    enable, priority, PRIMASK; handlers UART1_Handler,
+//           Timer0A_Handler and GPIOPortF_Handler (weak, may be missing)
+//   DWT     DWTCYCCNT counts simulated cycles, the time base of
+//           HostSim_Now and the models, and can be written; build
+//           hostsim.c with -DHOSTSIM_HOSTCYCCNT=1 to count host time in
+//           cycles of the firmware clock instead, so that Probe.h
+//           histograms measure the host build
+// Other peripherals are plain memory: writes stick, nothing happens.
+
+#ifndef __HOSTSIM_H__
+#define __HOSTSIM_H__
+#include <stdint.h>
+
+#define HOSTSIM_ACCESS 4      // cycles per modelled register access
+
+//------------HostSim_Init------------
+// Map the peripheral space and reset every model; call before the
+// firmware runs.  Simulated time starts at 0.
+// Output: 0 on success, -1 if the peripheral space could not be mapped
+int HostSim_Init(void);
+
+//------------HostSim_Now------------
+// Output: simulated CPU cycles since HostSim_Init
+uint64_t HostSim_Now(void);
+
+//------------HostSim_Us------------
+// Output: cycles in the given number of microseconds at Clock_GetFreq()
+uint64_t HostSim_Us(uint32_t us);
+
+//------------HostSim_Advance------------
+// Let simulated time pass as if the CPU were spinning, taking the
+// interrupts that come up
+// Input: cycles
+void HostSim_Advance(uint64_t cycles);
+
+//------------HostSim_SetEnd------------
+// Stop the simulation when simulated time reaches end: stop is called
+// (from wherever the firmware is) and must not return, e.g. it prints
+// results and calls exit
+// Input: time in cycles, function to call
+void HostSim_SetEnd(uint64_t end, void (*stop)(void));
+
+//------------HostSim_Schedule------------
+// Call a function once simulated time reaches a given point, from the
+// simulation as if it were a device doing something by itself (it may
+// send bytes, set pins, schedule itself again).  Up to 16 at a time.
+// Input: delay in cycles from now, function
+// Output: 0 on success, -1 if the table is full
+int HostSim_Schedule(uint64_t delay, void (*fn)(void));
+
+//------------HostSim_UART1Peer------------
+// Set the device on the other end of UART1
+// Input: function called with each byte the firmware sends, when its
+//        stop bit has been sent; 0 to drop them
+void HostSim_UART1Peer(void (*rx)(uint8_t data));
+
+//------------HostSim_UART1Send------------
+// Queue bytes for the firmware; they arrive back to back at the baud
+// rate, after the bytes already queued.  With RTS flow control enabled
+// the peer holds them while the hardware RX FIFO is full, otherwise
+// they are lost (counted as overruns).
+// Input: data, number of bytes
+// Output: number of bytes queued (the queue holds 64 kB)
+uint32_t HostSim_UART1Send(const uint8_t *data, uint32_t len);
+
+//------------HostSim_SetPin------------
+// Drive a GPIOF input pin; a change may set RIS and raise the interrupt
+// Input: pin 0 to 7, level 0 or 1
+void HostSim_SetPin(uint32_t pin, uint32_t level);
+
+//------------HostSim_GetPins------------
+// Output: GPIOF pin levels, outputs as the firmware last wrote them
+uint32_t HostSim_GetPins(void);
+
+typedef struct{
+  uint64_t uart1TxBytes, uart1RxBytes;
+  uint32_t uart1Overruns;       // bytes lost, hardware RX FIFO full
+  uint32_t uart1TxDropped;      // DR written with the TX FIFO full
+  uint32_t irqs[64];            // handler calls per interrupt number
+  uint64_t sleep;               // cycles spent in WaitForInterrupt
+} HostSimStats_t;
+
+//------------HostSim_Stats------------
+// Output: counters since HostSim_Init
+const HostSimStats_t *HostSim_Stats(void);
+
+#endif
@@ -0,0 +1,46 @@
+// mock.h
+// Runs on the host (Linux)
+// Forced into every firmware file with -include, see hostsim.h and the
+// build line in fwhost.c.  The sources stay unchanged:
+//  - the TM4C123 peripheral space (0x40000000-0x400FFFFF) is host memory
+//    mapped at the same address, so registers without side effects
+//    (configuration, GPIO, Timer0, ...) are plain memory that the models
+//    in hostsim.c read and update
+//  - registers whose access itself does something (UART1 and UART0 data
+//    and flags, SSI0 status) become calls that bring the model up to date
+//    and then return the register's address, as tools/st7735emu/mock.h
+//    does for SSI0_SR_R
+//  - the Cortex-M system registers are moved to a host array (scs.h)
+//  - the firmware's main becomes Firmware_Main, called by the host main
+
+#ifndef __HOSTSIM_MOCK_H__
+#define __HOSTSIM_MOCK_H__
+#include <stdint.h>
+#include <stdio.h>
+#include "../../inc/tm4c123gh6pm.h"
+#include "../../inc/CortexM.h"
+#include "../st7735emu/mock.h"
+#include "scs.h"
+
+volatile uint32_t *HostSim_UART1Reg(volatile uint32_t *reg);
+volatile uint32_t *HostSim_UART0Reg(volatile uint32_t *reg);
+volatile uint32_t *HostSim_SSI0SR(void);
+
+#undef UART1_DR_R
+#define UART1_DR_R  (*HostSim_UART1Reg((volatile uint32_t *)0x4000D000))
+#undef UART1_FR_R
+#define UART1_FR_R  (*HostSim_UART1Reg((volatile uint32_t *)0x4000D018))
+#undef UART1_RIS_R
+#define UART1_RIS_R (*HostSim_UART1Reg((volatile uint32_t *)0x4000D03C))
+#undef UART1_MIS_R
+#define UART1_MIS_R (*HostSim_UART1Reg((volatile uint32_t *)0x4000D040))
+#undef UART0_DR_R
+#define UART0_DR_R  (*HostSim_UART0Reg((volatile uint32_t *)0x4000C000))
+#undef UART0_FR_R
+#define UART0_FR_R  (*HostSim_UART0Reg((volatile uint32_t *)0x4000C018))
+#undef SSI0_SR_R
+#define SSI0_SR_R   (*HostSim_SSI0SR())
+
+#define main Firmware_Main
+
+#endif
@@ -0,0 +1,258 @@
+// scs.h
+// Runs on the host (Linux)
+// Included by mock.h.  Moves every Cortex-M system register of
+// tm4c123gh6pm.h and CortexM.h (0xE0000000-0xE00FFFFF: SysTick, NVIC,
+// SCB, DWT) into HostSim_Scs, a host array, because that range is in
+// AddressSanitizer's shadow gap and cannot be mapped at its own address.
+// The NVIC set/clear enable registers go through HostSim_NvicWrite so
+// their write-one-to-set/clear semantics work; reading them gives 0.
+// DWTCYCCNT reads the simulated cycle count, see hostsim.h.
+// Listed from the headers with
+//   grep -o "^#define [A-Z0-9_]* *(\*((volatile uint32_t \*)0xE00[0-9A-F]*))"
+// over inc/tm4c123gh6pm.h and inc/CortexM.h.
+
+#ifndef __HOSTSIM_SCS_H__
+#define __HOSTSIM_SCS_H__
+#include <stdint.h>
+
+extern uint8_t HostSim_Scs[];
+volatile uint32_t *HostSim_NvicWrite(uint32_t addr);
+volatile uint32_t *HostSim_CycCnt(void);
+
+#define HOSTSIM_SCS(addr) \
+  (*((volatile uint32_t *)&HostSim_Scs[(addr) - 0xE0000000u]))
+
+
+// tm4c123gh6pm.h
+#undef NVIC_ACTLR_R
+#define NVIC_ACTLR_R           HOSTSIM_SCS(0xE000E008)
+#undef NVIC_ST_CTRL_R
+#define NVIC_ST_CTRL_R         HOSTSIM_SCS(0xE000E010)
+#undef NVIC_ST_RELOAD_R
+#define NVIC_ST_RELOAD_R       HOSTSIM_SCS(0xE000E014)
+#undef NVIC_ST_CURRENT_R
+#define NVIC_ST_CURRENT_R      HOSTSIM_SCS(0xE000E018)
+#undef NVIC_EN0_R
+#define NVIC_EN0_R             (*HostSim_NvicWrite(0xE000E100))
+#undef NVIC_EN1_R
+#define NVIC_EN1_R             (*HostSim_NvicWrite(0xE000E104))
+#undef NVIC_EN2_R
+#define NVIC_EN2_R             (*HostSim_NvicWrite(0xE000E108))
+#undef NVIC_EN3_R
+#define NVIC_EN3_R             (*HostSim_NvicWrite(0xE000E10C))
+#undef NVIC_EN4_R
+#define NVIC_EN4_R             (*HostSim_NvicWrite(0xE000E110))
+#undef NVIC_DIS0_R
+#define NVIC_DIS0_R            (*HostSim_NvicWrite(0xE000E180))
+#undef NVIC_DIS1_R
+#define NVIC_DIS1_R            (*HostSim_NvicWrite(0xE000E184))
+#undef NVIC_DIS2_R
+#define NVIC_DIS2_R            (*HostSim_NvicWrite(0xE000E188))
+#undef NVIC_DIS3_R
+#define NVIC_DIS3_R            (*HostSim_NvicWrite(0xE000E18C))
+#undef NVIC_DIS4_R
+#define NVIC_DIS4_R            (*HostSim_NvicWrite(0xE000E190))
+#undef NVIC_PEND0_R
+#define NVIC_PEND0_R           HOSTSIM_SCS(0xE000E200)
+#undef NVIC_PEND1_R
+#define NVIC_PEND1_R           HOSTSIM_SCS(0xE000E204)
+#undef NVIC_PEND2_R
+#define NVIC_PEND2_R           HOSTSIM_SCS(0xE000E208)
+#undef NVIC_PEND3_R
+#define NVIC_PEND3_R           HOSTSIM_SCS(0xE000E20C)
+#undef NVIC_PEND4_R
+#define NVIC_PEND4_R           HOSTSIM_SCS(0xE000E210)
+#undef NVIC_UNPEND0_R
+#define NVIC_UNPEND0_R         HOSTSIM_SCS(0xE000E280)
+#undef NVIC_UNPEND1_R
+#define NVIC_UNPEND1_R         HOSTSIM_SCS(0xE000E284)
+#undef NVIC_UNPEND2_R
+#define NVIC_UNPEND2_R         HOSTSIM_SCS(0xE000E288)
+#undef NVIC_UNPEND3_R
+#define NVIC_UNPEND3_R         HOSTSIM_SCS(0xE000E28C)
+#undef NVIC_UNPEND4_R
+#define NVIC_UNPEND4_R         HOSTSIM_SCS(0xE000E290)
+#undef NVIC_ACTIVE0_R
+#define NVIC_ACTIVE0_R         HOSTSIM_SCS(0xE000E300)
+#undef NVIC_ACTIVE1_R
+#define NVIC_ACTIVE1_R         HOSTSIM_SCS(0xE000E304)
+#undef NVIC_ACTIVE2_R
+#define NVIC_ACTIVE2_R         HOSTSIM_SCS(0xE000E308)
+#undef NVIC_ACTIVE3_R
+#define NVIC_ACTIVE3_R         HOSTSIM_SCS(0xE000E30C)
+#undef NVIC_ACTIVE4_R
+#define NVIC_ACTIVE4_R         HOSTSIM_SCS(0xE000E310)
+#undef NVIC_PRI0_R
+#define NVIC_PRI0_R            HOSTSIM_SCS(0xE000E400)
+#undef NVIC_PRI1_R
+#define NVIC_PRI1_R            HOSTSIM_SCS(0xE000E404)
+#undef NVIC_PRI2_R
+#define NVIC_PRI2_R            HOSTSIM_SCS(0xE000E408)
+#undef NVIC_PRI3_R
+#define NVIC_PRI3_R            HOSTSIM_SCS(0xE000E40C)
+#undef NVIC_PRI4_R
+#define NVIC_PRI4_R            HOSTSIM_SCS(0xE000E410)
+#undef NVIC_PRI5_R
+#define NVIC_PRI5_R            HOSTSIM_SCS(0xE000E414)
+#undef NVIC_PRI6_R
+#define NVIC_PRI6_R            HOSTSIM_SCS(0xE000E418)
+#undef NVIC_PRI7_R
+#define NVIC_PRI7_R            HOSTSIM_SCS(0xE000E41C)
+#undef NVIC_PRI8_R
+#define NVIC_PRI8_R            HOSTSIM_SCS(0xE000E420)
+#undef NVIC_PRI9_R
+#define NVIC_PRI9_R            HOSTSIM_SCS(0xE000E424)
+#undef NVIC_PRI10_R
+#define NVIC_PRI10_R           HOSTSIM_SCS(0xE000E428)
+#undef NVIC_PRI11_R
+#define NVIC_PRI11_R           HOSTSIM_SCS(0xE000E42C)
+#undef NVIC_PRI12_R
+#define NVIC_PRI12_R           HOSTSIM_SCS(0xE000E430)
+#undef NVIC_PRI13_R
+#define NVIC_PRI13_R           HOSTSIM_SCS(0xE000E434)
+#undef NVIC_PRI14_R
+#define NVIC_PRI14_R           HOSTSIM_SCS(0xE000E438)
+#undef NVIC_PRI15_R
+#define NVIC_PRI15_R           HOSTSIM_SCS(0xE000E43C)
+#undef NVIC_PRI16_R
+#define NVIC_PRI16_R           HOSTSIM_SCS(0xE000E440)
+#undef NVIC_PRI17_R
+#define NVIC_PRI17_R           HOSTSIM_SCS(0xE000E444)
+#undef NVIC_PRI18_R
+#define NVIC_PRI18_R           HOSTSIM_SCS(0xE000E448)
+#undef NVIC_PRI19_R
+#define NVIC_PRI19_R           HOSTSIM_SCS(0xE000E44C)
+#undef NVIC_PRI20_R
+#define NVIC_PRI20_R           HOSTSIM_SCS(0xE000E450)
+#undef NVIC_PRI21_R
+#define NVIC_PRI21_R           HOSTSIM_SCS(0xE000E454)
+#undef NVIC_PRI22_R
+#define NVIC_PRI22_R           HOSTSIM_SCS(0xE000E458)
+#undef NVIC_PRI23_R
+#define NVIC_PRI23_R           HOSTSIM_SCS(0xE000E45C)
+#undef NVIC_PRI24_R
+#define NVIC_PRI24_R           HOSTSIM_SCS(0xE000E460)
+#undef NVIC_PRI25_R
+#define NVIC_PRI25_R           HOSTSIM_SCS(0xE000E464)
+#undef NVIC_PRI26_R
+#define NVIC_PRI26_R           HOSTSIM_SCS(0xE000E468)
+#undef NVIC_PRI27_R
+#define NVIC_PRI27_R           HOSTSIM_SCS(0xE000E46C)
+#undef NVIC_PRI28_R
+#define NVIC_PRI28_R           HOSTSIM_SCS(0xE000E470)
+#undef NVIC_PRI29_R
+#define NVIC_PRI29_R           HOSTSIM_SCS(0xE000E474)
+#undef NVIC_PRI30_R
+#define NVIC_PRI30_R           HOSTSIM_SCS(0xE000E478)
+#undef NVIC_PRI31_R
+#define NVIC_PRI31_R           HOSTSIM_SCS(0xE000E47C)
+#undef NVIC_PRI32_R
+#define NVIC_PRI32_R           HOSTSIM_SCS(0xE000E480)
+#undef NVIC_PRI33_R
+#define NVIC_PRI33_R           HOSTSIM_SCS(0xE000E484)
+#undef NVIC_PRI34_R
+#define NVIC_PRI34_R           HOSTSIM_SCS(0xE000E488)
+#undef NVIC_CPUID_R
+#define NVIC_CPUID_R           HOSTSIM_SCS(0xE000ED00)
+#undef NVIC_INT_CTRL_R
+#define NVIC_INT_CTRL_R        HOSTSIM_SCS(0xE000ED04)
+#undef NVIC_VTABLE_R
+#define NVIC_VTABLE_R          HOSTSIM_SCS(0xE000ED08)
+#undef NVIC_APINT_R
+#define NVIC_APINT_R           HOSTSIM_SCS(0xE000ED0C)
+#undef NVIC_SYS_CTRL_R
+#define NVIC_SYS_CTRL_R        HOSTSIM_SCS(0xE000ED10)
+#undef NVIC_CFG_CTRL_R
+#define NVIC_CFG_CTRL_R        HOSTSIM_SCS(0xE000ED14)
+#undef NVIC_SYS_PRI1_R
+#define NVIC_SYS_PRI1_R        HOSTSIM_SCS(0xE000ED18)
+#undef NVIC_SYS_PRI2_R
+#define NVIC_SYS_PRI2_R        HOSTSIM_SCS(0xE000ED1C)
+#undef NVIC_SYS_PRI3_R
+#define NVIC_SYS_PRI3_R        HOSTSIM_SCS(0xE000ED20)
+#undef NVIC_SYS_HND_CTRL_R
+#define NVIC_SYS_HND_CTRL_R    HOSTSIM_SCS(0xE000ED24)
+#undef NVIC_FAULT_STAT_R
+#define NVIC_FAULT_STAT_R      HOSTSIM_SCS(0xE000ED28)
+#undef NVIC_HFAULT_STAT_R
+#define NVIC_HFAULT_STAT_R     HOSTSIM_SCS(0xE000ED2C)
+#undef NVIC_DEBUG_STAT_R
+#define NVIC_DEBUG_STAT_R      HOSTSIM_SCS(0xE000ED30)
+#undef NVIC_MM_ADDR_R
+#define NVIC_MM_ADDR_R         HOSTSIM_SCS(0xE000ED34)
+#undef NVIC_FAULT_ADDR_R
+#define NVIC_FAULT_ADDR_R      HOSTSIM_SCS(0xE000ED38)
+#undef NVIC_CPAC_R
+#define NVIC_CPAC_R            HOSTSIM_SCS(0xE000ED88)
+#undef NVIC_MPU_TYPE_R
+#define NVIC_MPU_TYPE_R        HOSTSIM_SCS(0xE000ED90)
+#undef NVIC_MPU_CTRL_R
+#define NVIC_MPU_CTRL_R        HOSTSIM_SCS(0xE000ED94)
+#undef NVIC_MPU_NUMBER_R
+#define NVIC_MPU_NUMBER_R      HOSTSIM_SCS(0xE000ED98)
+#undef NVIC_MPU_BASE_R
+#define NVIC_MPU_BASE_R        HOSTSIM_SCS(0xE000ED9C)
+#undef NVIC_MPU_ATTR_R
+#define NVIC_MPU_ATTR_R        HOSTSIM_SCS(0xE000EDA0)
+#undef NVIC_MPU_BASE1_R
+#define NVIC_MPU_BASE1_R       HOSTSIM_SCS(0xE000EDA4)
+#undef NVIC_MPU_ATTR1_R
+#define NVIC_MPU_ATTR1_R       HOSTSIM_SCS(0xE000EDA8)
+#undef NVIC_MPU_BASE2_R
+#define NVIC_MPU_BASE2_R       HOSTSIM_SCS(0xE000EDAC)
+#undef NVIC_MPU_ATTR2_R
+#define NVIC_MPU_ATTR2_R       HOSTSIM_SCS(0xE000EDB0)
+#undef NVIC_MPU_BASE3_R
+#define NVIC_MPU_BASE3_R       HOSTSIM_SCS(0xE000EDB4)
+#undef NVIC_MPU_ATTR3_R
+#define NVIC_MPU_ATTR3_R       HOSTSIM_SCS(0xE000EDB8)
+#undef NVIC_DBG_CTRL_R
+#define NVIC_DBG_CTRL_R        HOSTSIM_SCS(0xE000EDF0)
+#undef NVIC_DBG_XFER_R
+#define NVIC_DBG_XFER_R        HOSTSIM_SCS(0xE000EDF4)
+#undef NVIC_DBG_DATA_R
+#define NVIC_DBG_DATA_R        HOSTSIM_SCS(0xE000EDF8)
+#undef NVIC_DBG_INT_R
+#define NVIC_DBG_INT_R         HOSTSIM_SCS(0xE000EDFC)
+#undef NVIC_SW_TRIG_R
+#define NVIC_SW_TRIG_R         HOSTSIM_SCS(0xE000EF00)
+#undef NVIC_FPCC_R
+#define NVIC_FPCC_R            HOSTSIM_SCS(0xE000EF34)
+#undef NVIC_FPCA_R
+#define NVIC_FPCA_R            HOSTSIM_SCS(0xE000EF38)
+#undef NVIC_FPDSC_R
+#define NVIC_FPDSC_R           HOSTSIM_SCS(0xE000EF3C)
+
+// CortexM.h
+#undef STCTRL
+#define STCTRL                 HOSTSIM_SCS(0xE000E010)
+#undef STRELOAD
+#define STRELOAD               HOSTSIM_SCS(0xE000E014)
+#undef STCURRENT
+#define STCURRENT              HOSTSIM_SCS(0xE000E018)
+#undef INTCTRL
+#define INTCTRL                HOSTSIM_SCS(0xE000ED04)
+#undef SYSPRI1
+#define SYSPRI1                HOSTSIM_SCS(0xE000ED18)
+#undef SYSPRI2
+#define SYSPRI2                HOSTSIM_SCS(0xE000ED1C)
+#undef SYSPRI3
+#define SYSPRI3                HOSTSIM_SCS(0xE000ED20)
+#undef SYSHNDCTRL
+#define SYSHNDCTRL             HOSTSIM_SCS(0xE000ED24)
+#undef FAULTSTAT
+#define FAULTSTAT              HOSTSIM_SCS(0xE000ED28)
+#undef HFAULTSTAT
+#define HFAULTSTAT             HOSTSIM_SCS(0xE000ED2C)
+#undef MMADDR
+#define MMADDR                 HOSTSIM_SCS(0xE000ED34)
+#undef FAULTADDR
+#define FAULTADDR              HOSTSIM_SCS(0xE000ED38)
+#undef DEMCR
+#define DEMCR                  HOSTSIM_SCS(0xE000EDFC)
+#undef DWTCTRL
+#define DWTCTRL                HOSTSIM_SCS(0xE0001000)
+#undef DWTCYCCNT
+#define DWTCYCCNT              (*HostSim_CycCnt())
+
+#endif
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Decode a message log dump from the TM4C (see TM4C/Log.h).
+
+BLEHandler_TraceDump sends the BGAPI trace and then the log out UART0
+(115200 8N1); capture it into a file, e.g.
+  stty -F /dev/ttyACM0 115200 raw && cat /dev/ttyACM0 > dump.bin
+then
+  python3 tools/log_decode.py dump.bin
+
+Prints every record, oldest first, with its time in seconds, its message
+name and its text, formatted with the same format strings the panel uses
+(the DISPLAY_MSG_ enum in TM4C/Display.h and Formats in TM4C/Display.c).
+"""
+import argparse
+import ast
+import os
+import re
+import struct
+import sys
+
+TM4C = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'TM4C')
+MAXARGS = 6
+RECORD = struct.Struct('<IBB%dH' % MAXARGS)
+
+
+def load_formats():
+    with open(os.path.join(TM4C, 'Display.h')) as f:
+        body = re.search(r'enum\s*{(.*?)DISPLAY_MSG_COUNT', f.read(), re.S).group(1)
+    names = re.findall(r'^\s*(DISPLAY_MSG_\w+)', body, re.M)
+    with open(os.path.join(TM4C, 'Display.c')) as f:
+        table = dict(re.findall(r'\[(DISPLAY_MSG_\w+)\]\s*=\s*("(?:[^"\\]|\\.)*")', f.read()))
+    return [(name[len('DISPLAY_MSG_'):], ast.literal_eval(table.get(name, '""')))
+            for name in names]
+
+
+def read_dump(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    start = data.find(b'LOGR')
+    if start < 0:
+        sys.exit('no LOGR header in ' + path)
+    version, freq, count = struct.unpack_from('<III', data, start + 4)
+    if version != 1:
+        sys.exit('unknown log version %d' % version)
+    body = data[start + 16:]
+    count = min(count, len(body) // RECORD.size)
+    records = []
+    last = None
+    high = 0
+    for i in range(count):
+        cycles, msg, n, *args = RECORD.unpack_from(body, i * RECORD.size)
+        if last is not None and cycles < last:
+            high += 1 << 32        # the 32-bit cycle counter wrapped
+        last = cycles
+        records.append(((high + cycles) / freq, msg, args[:n]))
+    return freq, records
+
+
+def text(fmt, args):
+    used = len(re.findall(r'%[-0-9]*[duxXc]', fmt))
+    args = (list(args) + [0] * MAXARGS)[:used]
+    return (fmt % tuple(args)).replace('\n', ' / ')
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('dump')
+    args = ap.parse_args()
+
+    formats = load_formats()
+    freq, records = read_dump(args.dump)
+    print('%d records, cycle counter %d Hz' % (len(records), freq))
+    for t, msg, margs in records:
+        if msg < len(formats):
+            name, fmt = formats[msg]
+            print('%12.6f  %-18s %s' % (t, name, text(fmt, margs)))
+        else:
+            print('%12.6f  %-18s %s' % (t, 'msg_%d' % msg, ' '.join(str(a) for a in margs)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""Convert an image to the run-length format of ST7735_DrawBitmapRLE.
+
+  python3 tools/rle_convert.py splash.bmp Splash > TM4C/Splash.c
+  python3 tools/rle_convert.py splash.ppm Splash --verify
+
+Reads uncompressed 24- or 32-bit .bmp files and binary .ppm (P6) files,
+e.g. the snapshots of tools/st7735emu.  Writes C source that defines
+  const ST7735_RLEImage_t Splash;
+for ST7735_DrawBitmapRLE (declare it extern where it is drawn).  Colors
+are converted like ST7735_Color565.  The palette holds up to 256 colors;
+an image with more loses low color bits until it fits (reported on
+stderr, along with the flash used compared to a ST7735_DrawBitmap array).
+
+Format (see ST7735.h): palette indices, top row first, in runs.  A code
+byte with bit 7 set repeats the next index (code & 0x7f) + 1 times, any
+other code is followed by code + 1 literal indices.
+"""
+import argparse
+import struct
+import sys
+from collections import Counter
+
+MAXRUN = 128
+MINREPEAT = 3     # shorter runs stay inside literals
+
+
+def read_bmp(data):
+    if data[:2] != b'BM':
+        raise ValueError('not a BMP file')
+    offset, = struct.unpack_from('<I', data, 10)
+    width, height, planes, bits, compression = struct.unpack_from('<iiHHI', data, 18)
+    if bits not in (24, 32) or compression not in (0, 3):
+        raise ValueError('only uncompressed 24- or 32-bit BMP files are supported')
+    bottom_up = height > 0
+    height = abs(height)
+    step = bits // 8
+    stride = (width * step + 3) & ~3
+    rows = []
+    for r in range(height):
+        base = offset + r * stride
+        rows.append([(data[base + c * step + 2], data[base + c * step + 1], data[base + c * step])
+                     for c in range(width)])
+    if bottom_up:
+        rows.reverse()
+    return width, height, rows
+
+
+def read_ppm(data):
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or int(fields[3]) != 255:
+        raise ValueError('only binary 8-bit PPM (P6) files are supported')
+    width, height = int(fields[1]), int(fields[2])
+    pos += 1
+    rows = []
+    for r in range(height):
+        base = pos + r * width * 3
+        rows.append([tuple(data[base + c * 3:base + c * 3 + 3]) for c in range(width)])
+    return width, height, rows
+
+
+def color565(r, g, b):
+    """Same as ST7735_Color565."""
+    return ((b & 0xf8) << 8) | ((g & 0xfc) << 3) | (r >> 3)
+
+
+def quantize(pixels):
+    """Colors and palette, dropping low bits until there are at most 256."""
+    for drop in range(0, 5):
+        rb = (0xf8 << drop) & 0xff
+        gm = (0xfc << drop) & 0xff
+        colors = [color565(r & rb, g & gm, b & rb) for r, g, b in pixels]
+        palette = [c for c, n in Counter(colors).most_common()]
+        if len(palette) <= 256:
+            if drop:
+                print('note: %d low bits dropped per channel to fit 256 colors' % drop,
+                      file=sys.stderr)
+            return colors, palette
+    raise ValueError('too many colors')
+
+
+def encode(indices):
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:MAXRUN]
+            del literal[:MAXRUN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < MAXRUN:
+            run += 1
+        if run >= MINREPEAT:
+            flush()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+        else:
+            literal.extend(indices[i:i + run])
+        i += run
+    flush()
+    return bytes(out)
+
+
+def decode(data, palette, count):
+    """Reference decoder, the inverse of encode."""
+    out = []
+    pos = 0
+    while len(out) < count:
+        code = data[pos]
+        pos += 1
+        if code & 0x80:
+            out.extend([palette[data[pos]]] * ((code & 0x7f) + 1))
+            pos += 1
+        else:
+            out.extend(palette[i] for i in data[pos:pos + code + 1])
+            pos += code + 1
+    return out
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    ap.add_argument('image', help='.bmp or .ppm file')
+    ap.add_argument('name', help='C name of the image')
+    ap.add_argument('--header', default='../inc/ST7735.h',
+                    help='path of ST7735.h as the output file includes it')
+    ap.add_argument('--verify', action='store_true',
+                    help='decode the result and compare, print nothing else')
+    args = ap.parse_args()
+
+    with open(args.image, 'rb') as f:
+        data = f.read()
+    width, height, rows = read_ppm(data) if data[:2] == b'P6' else read_bmp(data)
+    pixels = [p for row in rows for p in row]
+    colors, palette = quantize(pixels)
+    lookup = {c: i for i, c in enumerate(palette)}
+    runs = encode([lookup[c] for c in colors])
+
+    if decode(runs, palette, len(colors)) != colors:
+        print('error: decoded image differs', file=sys.stderr)
+        return 1
+    raw = 2 * width * height
+    size = 2 * len(palette) + len(runs) + 12
+    print('%s: %dx%d, %d colors, %d bytes of flash (%d as a DrawBitmap array, %.1f%%)'
+          % (args.name, width, height, len(palette), size, raw, 100.0 * size / raw),
+          file=sys.stderr)
+    if args.verify:
+        return 0
+
+    print('// %s, %dx%d from %s by tools/rle_convert.py' % (args.name, width, height, args.image))
+    print('// %d colors, %d bytes of runs' % (len(palette), len(runs)))
+    print('#include <stdint.h>')
+    print('#include "%s"' % args.header)
+    print()
+    print('static const uint16_t %s_palette[%d] = {' % (args.name, len(palette)))
+    print(c_array(palette, '0x%04X', 8))
+    print('};')
+    print('static const uint8_t %s_data[%d] = {' % (args.name, len(runs)))
+    print(c_array(runs, '0x%02X', 12))
+    print('};')
+    print('const ST7735_RLEImage_t %s = {%d, %d, %d, %s_palette, %s_data};'
+          % (args.name, width, height, len(palette), args.name, args.name))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
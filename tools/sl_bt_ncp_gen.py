@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Generate the table-driven BGAPI command layer for the NCP host.
+
+Reads the API definitions in TM4C/BGLib:
+  sl_bt_api.h    public sl_bt_* prototypes
+  sl_bt_types.h  sl_bt_cmd_*_id command IDs
+  sli_bt_api.h   packed sl_bt_cmd_*_s / sl_bt_rsp_*_s field layouts
+and writes:
+  sl_bt_ncp_host_table.h  SL_BT_CMD(name, id, layout) descriptor table
+  sl_bt_ncp_host_api.c    one-line sl_bt_* wrappers around sl_bt_host_command(),
+                          with the layout strings expanded from the table
+
+Layout strings are described in sl_bt_ncp_host_cmd.h. Run from anywhere:
+  python3 tools/sl_bt_ncp_gen.py
+(Keil: Options for Target > User > Before Build/Rebuild, Run #1:
+  python ..\\tools\\sl_bt_ncp_gen.py)
+"""
+import os
+import re
+import sys
+
+BGLIB = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'TM4C', 'BGLib')
+
+# field type in sli_bt_api.h -> layout code
+CODES = {
+    'uint8_t': 'b', 'int8_t': 'b',
+    'uint16_t': 'h', 'int16_t': 'h',
+    'uint32_t': 'w', 'int32_t': 'w',
+    'bd_addr': 'a',
+    'uint8array': 'A',
+}
+
+
+def read(name):
+    with open(os.path.join(BGLIB, name)) as f:
+        return f.read()
+
+
+def parse_structs(text):
+    structs = {}
+    for m in re.finditer(r'PACKSTRUCT\( struct (sl_bt_(?:cmd|rsp)_\w+)_s\s*\{(.*?)\}\);', text, re.S):
+        fields = []
+        for line in m.group(2).strip().splitlines():
+            typ, name = line.strip().rstrip(';').split()
+            fields.append((typ, name))
+        structs[m.group(1)] = fields
+    return structs
+
+
+def parse_prototypes(text):
+    protos = {}
+    for m in re.finditer(r'^(sl_status_t|void) (sl_bt_\w+)\(([^;]*?)\);', text, re.M | re.S):
+        params = []
+        for p in m.group(3).split(','):
+            p = ' '.join(p.split())
+            if p:
+                pm = re.match(r'(.*?)(\w+)$', p)
+                params.append((pm.group(1).strip(), pm.group(2)))
+        protos[m.group(2)] = (m.group(1), params, m.group(0)[:-1])
+    return protos
+
+
+def layout(name, ret, params, cmd_fields, rsp_fields):
+    """Build the layout string and check it against the parameter list."""
+    expect = []
+    fmt = ''
+    for typ, field in cmd_fields:
+        code = CODES[typ]
+        fmt += code
+        expect += [field + '_len', field] if code == 'A' else [field]
+    if ret == 'void':
+        if rsp_fields:
+            raise ValueError(name + ': void command with a response')
+    else:
+        if not rsp_fields or rsp_fields[0] != ('uint16_t', 'result'):
+            raise ValueError(name + ': response does not start with result')
+        fmt += '>'
+        for typ, field in rsp_fields[1:]:
+            code = CODES[typ]
+            fmt += code
+            expect += ['max_' + field + '_size', field + '_len', field] if code == 'A' else [field]
+    for i, code in enumerate(fmt):
+        if code == 'A' and i + 1 < len(fmt) and fmt[i + 1] != '>':
+            raise ValueError(name + ': array must be the last field')
+    got = [p[1] for p in params]
+    if got != expect:
+        raise ValueError('%s: parameters %s do not match layout %s' % (name, got, expect))
+    return fmt
+
+
+def main():
+    protos = parse_prototypes(read('sl_bt_api.h'))
+    structs = parse_structs(read('sli_bt_api.h'))
+    ids = re.findall(r'#define sl_bt_cmd_(\w+)_id\s+(0x[0-9a-fA-F]+)', read('sl_bt_types.h'))
+
+    table = []
+    wrappers = []
+    for cmd, cid in ids:
+        func = 'sl_bt_' + cmd
+        if func not in protos:
+            continue
+        ret, params, proto = protos[func]
+        fmt = layout(func, ret, params,
+                     structs.get('sl_bt_cmd_' + cmd, []),
+                     structs.get('sl_bt_rsp_' + cmd, []))
+        table.append('  SL_BT_CMD(%-44s %s, "%s")' % (cmd + ',', cid, fmt))
+        args = ''.join(', ' + p[1] for p in params)
+        call = 'sl_bt_host_command(sl_bt_cmd_%s_id, layout_%s%s)' % (cmd, cmd, args)
+        if ret == 'void':
+            body = '    %s;\n' % call
+        else:
+            body = '    return %s;\n' % call
+        wrappers.append('%s {\n%s}\n' % (proto, body))
+
+    header = read('sl_bt_ncp_host_api.c').split('\n#include', 1)[0] if os.path.exists(
+        os.path.join(BGLIB, 'sl_bt_ncp_host_api.c')) else ''
+    with open(os.path.join(BGLIB, 'sl_bt_ncp_host_api.c'), 'w') as f:
+        f.write(header)
+        f.write('\n#include "sl_bt_api.h"\n#include "sl_bt_ncp_host_cmd.h"\n')
+        f.write('#include "sl_bt_ncp_host_table.h"\n\n')
+        f.write('// Generated by tools/sl_bt_ncp_gen.py, do not edit.\n')
+        f.write('// Each command is packed by sl_bt_host_command() from its layout string\n')
+        f.write('// in sl_bt_ncp_host_table.h, expanded here as layout_<command>.\n\n')
+        f.write('#define SL_BT_CMD(name, id, layout) static const char layout_##name[] = layout;\n')
+        f.write('SL_BT_CMD_TABLE\n#undef SL_BT_CMD\n\n')
+        f.write('\n'.join(wrappers))
+    with open(os.path.join(BGLIB, 'sl_bt_ncp_host_table.h'), 'w') as f:
+        f.write('// sl_bt_ncp_host_table.h\n')
+        f.write('// Generated by tools/sl_bt_ncp_gen.py from sl_bt_api.h, sl_bt_types.h and\n')
+        f.write('// sli_bt_api.h, do not edit.\n')
+        f.write('// One SL_BT_CMD(name, id, layout) entry per NCP command, layout codes are\n')
+        f.write('// described in sl_bt_ncp_host_cmd.h. Define SL_BT_CMD before expanding\n')
+        f.write('// SL_BT_CMD_TABLE, e.g. to build name or layout lookup tables.\n\n')
+        f.write('#ifndef SL_BT_NCP_HOST_TABLE_H\n#define SL_BT_NCP_HOST_TABLE_H\n\n')
+        f.write('#define SL_BT_CMD_TABLE \\\n')
+        f.write(' \\\n'.join(table))
+        f.write('\n\n#endif\n')
+    print('%d commands' % len(table))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,31 @@
+// mock.h
+// Runs on the host (Linux)
+// Forced into inc/ST7735.c with -include so the unchanged driver talks to
+// the emulator in st7735emu.c instead of SSI0:
+//  - the TM4C123 peripheral space (0x40000000-0x400FFFFF) is plain host
+//    memory mapped at the same address by ST7735Emu_Init, so every
+//    register macro of tm4c123gh6pm.h and the driver's own TFT_CS, DC
+//    and RESET pin addresses just work
+//  - SSI0_SR_R becomes a function call.  The driver reads the status
+//    before every byte it writes to SSI0_DR_R and after every command,
+//    so that call hands the byte last written (with the D/C pin level
+//    at that moment) to the emulated panel, then reports "not busy,
+//    FIFO not full"
+//  - the driver's printf hooks are renamed so they do not replace libc's
+
+#ifndef __ST7735EMU_MOCK_H__
+#define __ST7735EMU_MOCK_H__
+#include <stdint.h>
+#include <stdio.h>
+#include "../../inc/tm4c123gh6pm.h"
+
+volatile uint32_t *ST7735Emu_SSI0SR(void);
+
+#undef SSI0_SR_R
+#define SSI0_SR_R (*ST7735Emu_SSI0SR())
+
+#define fputc  ST7735_fputc
+#define fgetc  ST7735_fgetc
+#define ferror ST7735_ferror
+
+#endif
@@ -0,0 +1,222 @@
+// Splash, 128x160 from splash.ppm by tools/rle_convert.py
+// 131 colors, 2334 bytes of runs
+#include <stdint.h>
+#include "../../inc/ST7735.h"
+
+static const uint16_t Splash_palette[131] = {
+  0xE000, 0x0000, 0x001C, 0x079C, 0x0780, 0xE79C, 0x2004, 0x4008,
+  0x600C, 0x8010, 0xA014, 0xC018, 0xE01C, 0x0080, 0x2084, 0x4088,
+  0x608C, 0x8090, 0xA094, 0xC098, 0xE09C, 0x0100, 0x2104, 0x4108,
+  0x610C, 0x8110, 0xA114, 0xC118, 0xE11C, 0x0180, 0x2184, 0x4188,
+  0x618C, 0x8190, 0xA194, 0xC198, 0xE19C, 0x0200, 0x2204, 0x4208,
+  0x620C, 0x8210, 0xA214, 0xC218, 0xE21C, 0x0280, 0x2284, 0x4288,
+  0x628C, 0x8290, 0xA294, 0xC298, 0xE29C, 0x0300, 0x2304, 0x4308,
+  0x630C, 0x8310, 0xA314, 0xC318, 0xE31C, 0x0380, 0x2384, 0x4388,
+  0x638C, 0x8390, 0xA394, 0xC398, 0xE39C, 0x0400, 0x2404, 0x4408,
+  0x640C, 0x8410, 0xA414, 0xC418, 0xE41C, 0x0480, 0x2484, 0x4488,
+  0x648C, 0x8490, 0xA494, 0xC498, 0xE49C, 0x0500, 0x2504, 0x4508,
+  0x650C, 0x8510, 0xA514, 0xC518, 0xE51C, 0x0580, 0x2584, 0x4588,
+  0x658C, 0x8590, 0xA594, 0xC598, 0xE59C, 0x0600, 0x2604, 0x4608,
+  0x660C, 0x8610, 0xA614, 0xC618, 0xE61C, 0x0680, 0x2684, 0x4688,
+  0x668C, 0x8690, 0xA694, 0xC698, 0xE69C, 0x0700, 0x2704, 0x4708,
+  0x670C, 0x8710, 0xA714, 0xC718, 0xE71C, 0x2784, 0x4788, 0x678C,
+  0x8790, 0xA794, 0xC798,
+};
+static const uint8_t Splash_data[2334] = {
+  0xBF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xC3, 0x00, 0x00, 0x05,
+  0xB9, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02,
+  0x8D, 0x00, 0x00, 0x03, 0xC8, 0x00, 0xA7, 0x02, 0x8D, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xBE, 0x00, 0xFF, 0x03, 0xBF, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x02, 0x01,
+  0x01, 0x05, 0x84, 0x01, 0x00, 0x05, 0x82, 0x01, 0x87, 0x05, 0x83, 0x01,
+  0x85, 0x00, 0x00, 0x01, 0x82, 0x05, 0x01, 0x01, 0x01, 0x9B, 0x00, 0x00,
+  0x03, 0xBE, 0x00, 0x03, 0x01, 0x05, 0x01, 0x05, 0x82, 0x01, 0x04, 0x05,
+  0x01, 0x05, 0x01, 0x01, 0x87, 0x05, 0x83, 0x01, 0x85, 0x00, 0x00, 0x05,
+  0x82, 0x01, 0x01, 0x05, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x00,
+  0x05, 0x82, 0x01, 0x02, 0x05, 0x01, 0x05, 0x82, 0x01, 0x03, 0x05, 0x01,
+  0x05, 0x05, 0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0x85, 0x00, 0x00,
+  0x05, 0x84, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x00, 0x05, 0x82,
+  0x01, 0x02, 0x05, 0x01, 0x05, 0x82, 0x01, 0x03, 0x05, 0x01, 0x05, 0x05,
+  0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0x85, 0x00, 0x00, 0x05, 0x84,
+  0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x84, 0x05, 0x00, 0x01, 0x84,
+  0x05, 0x02, 0x01, 0x05, 0x05, 0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01,
+  0x85, 0x00, 0x00, 0x05, 0x84, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE, 0x00,
+  0x00, 0x05, 0x82, 0x01, 0x02, 0x05, 0x01, 0x05, 0x82, 0x01, 0x03, 0x05,
+  0x01, 0x05, 0x05, 0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0x85, 0x00,
+  0x00, 0x05, 0x82, 0x01, 0x01, 0x05, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE,
+  0x00, 0x00, 0x05, 0x82, 0x01, 0x02, 0x05, 0x01, 0x05, 0x82, 0x01, 0x01,
+  0x05, 0x01, 0x87, 0x05, 0x83, 0x01, 0x85, 0x00, 0x00, 0x01, 0x82, 0x05,
+  0x01, 0x01, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x8B, 0x01, 0x87,
+  0x05, 0x83, 0x01, 0x85, 0x00, 0x85, 0x01, 0x9B, 0x00, 0x00, 0x03, 0xCA,
+  0x00, 0x01, 0x05, 0x05, 0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0xA7,
+  0x00, 0x00, 0x03, 0xCA, 0x00, 0x01, 0x05, 0x05, 0x85, 0x01, 0x03, 0x05,
+  0x05, 0x01, 0x01, 0xA7, 0x00, 0x00, 0x03, 0xCA, 0x00, 0x01, 0x05, 0x05,
+  0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0xA7, 0x00, 0x00, 0x03, 0xCA,
+  0x00, 0x01, 0x05, 0x05, 0x85, 0x01, 0x03, 0x05, 0x05, 0x01, 0x01, 0xA7,
+  0x00, 0x00, 0x03, 0xCA, 0x00, 0x87, 0x05, 0x83, 0x01, 0xA7, 0x00, 0x00,
+  0x03, 0xCA, 0x00, 0x87, 0x05, 0x83, 0x01, 0xA7, 0x00, 0x00, 0x03, 0xCA,
+  0x00, 0x8B, 0x01, 0xA7, 0x00, 0x00, 0x03, 0xCA, 0x00, 0x8B, 0x01, 0xA7,
+  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE,
+  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x00, 0x01, 0x82,
+  0x04, 0x83, 0x01, 0x00, 0x04, 0x83, 0x01, 0x82, 0x04, 0x01, 0x01, 0x01,
+  0x84, 0x04, 0x83, 0x01, 0x02, 0x04, 0x01, 0x01, 0x84, 0x04, 0x82, 0x01,
+  0x82, 0x04, 0x00, 0x01, 0x84, 0x04, 0x01, 0x01, 0x01, 0x82, 0x04, 0x82,
+  0x01, 0x82, 0x04, 0x87, 0x01, 0x00, 0x04, 0x8E, 0x01, 0x00, 0x04, 0x89,
+  0x01, 0x00, 0x04, 0x87, 0x01, 0x00, 0x04, 0x86, 0x01, 0x00, 0x04, 0x85,
+  0x01, 0x03, 0x04, 0x01, 0x01, 0x04, 0x84, 0x01, 0x02, 0x00, 0x00, 0x04,
+  0x82, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x82, 0x01, 0x00, 0x04,
+  0x82, 0x01, 0x00, 0x04, 0x84, 0x01, 0x00, 0x04, 0x82, 0x01, 0x04, 0x04,
+  0x04, 0x01, 0x01, 0x04, 0x85, 0x01, 0x00, 0x04, 0x87, 0x01, 0x02, 0x04,
+  0x01, 0x04, 0x82, 0x01, 0x02, 0x04, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04,
+  0x86, 0x01, 0x00, 0x04, 0x8E, 0x01, 0x00, 0x04, 0x88, 0x01, 0x02, 0x04,
+  0x01, 0x04, 0x86, 0x01, 0x00, 0x04, 0x90, 0x01, 0x00, 0x04, 0x84, 0x01,
+  0x06, 0x00, 0x00, 0x04, 0x01, 0x01, 0x04, 0x04, 0x82, 0x01, 0x00, 0x04,
+  0x86, 0x01, 0x00, 0x04, 0x83, 0x01, 0x00, 0x04, 0x82, 0x01, 0x04, 0x04,
+  0x01, 0x04, 0x01, 0x01, 0x83, 0x04, 0x02, 0x01, 0x01, 0x04, 0x88, 0x01,
+  0x02, 0x04, 0x01, 0x04, 0x82, 0x01, 0x02, 0x04, 0x01, 0x04, 0x82, 0x01,
+  0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x82, 0x01, 0x03, 0x04, 0x01, 0x04,
+  0x04, 0x82, 0x01, 0x82, 0x04, 0x82, 0x01, 0x05, 0x04, 0x04, 0x01, 0x04,
+  0x01, 0x01, 0x82, 0x04, 0x83, 0x01, 0x00, 0x04, 0x83, 0x01, 0x82, 0x04,
+  0x05, 0x01, 0x01, 0x04, 0x01, 0x04, 0x04, 0x82, 0x01, 0x01, 0x04, 0x04,
+  0x85, 0x01, 0x0F, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x00, 0x00, 0x04, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04, 0x83,
+  0x01, 0x82, 0x04, 0x83, 0x01, 0x07, 0x04, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x85, 0x01, 0x01, 0x04, 0x01, 0x83, 0x04, 0x84, 0x01, 0x00,
+  0x04, 0x82, 0x01, 0x82, 0x04, 0x82, 0x01, 0x83, 0x04, 0x83, 0x01, 0x09,
+  0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01,
+  0x08, 0x04, 0x01, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04, 0x82, 0x01,
+  0x02, 0x04, 0x01, 0x01, 0x82, 0x04, 0x0C, 0x01, 0x01, 0x04, 0x01, 0x01,
+  0x04, 0x04, 0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04,
+  0x85, 0x01, 0x05, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01, 0x06,
+  0x00, 0x00, 0x04, 0x04, 0x01, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82,
+  0x01, 0x00, 0x04, 0x88, 0x01, 0x01, 0x04, 0x01, 0x84, 0x04, 0x84, 0x01,
+  0x02, 0x04, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04,
+  0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x84, 0x01, 0x02, 0x04,
+  0x01, 0x01, 0x82, 0x04, 0x02, 0x01, 0x01, 0x04, 0x82, 0x01, 0x02, 0x04,
+  0x01, 0x04, 0x84, 0x01, 0x00, 0x04, 0x82, 0x01, 0x01, 0x04, 0x01, 0x84,
+  0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x06, 0x04, 0x01, 0x01, 0x04,
+  0x04, 0x01, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x85,
+  0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x04, 0x83, 0x01, 0x02, 0x00, 0x00,
+  0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00,
+  0x04, 0x84, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00, 0x04, 0x83, 0x01, 0x03,
+  0x04, 0x01, 0x01, 0x04, 0x82, 0x01, 0x02, 0x04, 0x01, 0x04, 0x82, 0x01,
+  0x03, 0x04, 0x01, 0x01, 0x04, 0x83, 0x01, 0x00, 0x04, 0x82, 0x01, 0x00,
+  0x04, 0x83, 0x01, 0x0F, 0x04, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x04, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01, 0x08, 0x04,
+  0x01, 0x04, 0x01, 0x01, 0x04, 0x04, 0x01, 0x04, 0x86, 0x01, 0x00, 0x04,
+  0x83, 0x01, 0x05, 0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01, 0x00,
+  0x04, 0x82, 0x01, 0x00, 0x04, 0x82, 0x01, 0x08, 0x04, 0x01, 0x01, 0x04,
+  0x01, 0x01, 0x04, 0x01, 0x04, 0x82, 0x01, 0x02, 0x00, 0x00, 0x01, 0x82,
+  0x04, 0x82, 0x01, 0x82, 0x04, 0x01, 0x01, 0x01, 0x84, 0x04, 0x01, 0x01,
+  0x01, 0x82, 0x04, 0x84, 0x01, 0x00, 0x04, 0x82, 0x01, 0x82, 0x04, 0x82,
+  0x01, 0x82, 0x04, 0x02, 0x01, 0x01, 0x04, 0x85, 0x01, 0x82, 0x04, 0x01,
+  0x01, 0x01, 0x82, 0x04, 0x83, 0x01, 0x83, 0x04, 0x04, 0x01, 0x04, 0x01,
+  0x04, 0x04, 0x82, 0x01, 0x82, 0x04, 0x82, 0x01, 0x05, 0x04, 0x04, 0x01,
+  0x04, 0x01, 0x01, 0x82, 0x04, 0x83, 0x01, 0x00, 0x04, 0x86, 0x01, 0x02,
+  0x04, 0x01, 0x04, 0x82, 0x01, 0x02, 0x04, 0x01, 0x01, 0x82, 0x04, 0x82,
+  0x01, 0x01, 0x04, 0x04, 0x82, 0x01, 0x07, 0x04, 0x01, 0x01, 0x04, 0x01,
+  0x01, 0x00, 0x00, 0xE0, 0x01, 0x82, 0x04, 0x99, 0x01, 0xC1, 0x00, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00,
+  0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xBE, 0x00, 0x00,
+  0x03, 0x82, 0x01, 0x00, 0x03, 0x87, 0x01, 0x01, 0x03, 0x03, 0x83, 0x01,
+  0x01, 0x03, 0x03, 0xA7, 0x01, 0x01, 0x03, 0x03, 0x86, 0x01, 0x01, 0x03,
+  0x01, 0xB7, 0x00, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03, 0x88, 0x01, 0x00,
+  0x03, 0x84, 0x01, 0x00, 0x03, 0xA8, 0x01, 0x00, 0x03, 0x86, 0x01, 0x01,
+  0x03, 0x01, 0xB7, 0x00, 0x00, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x82, 0x03, 0x83, 0x01, 0x00, 0x03, 0x84, 0x01, 0x00, 0x03, 0x83, 0x01,
+  0x82, 0x03, 0x8D, 0x01, 0x00, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x01,
+  0x82, 0x03, 0x05, 0x01, 0x01, 0x03, 0x01, 0x03, 0x03, 0x83, 0x01, 0x00,
+  0x03, 0x83, 0x01, 0x04, 0x03, 0x03, 0x01, 0x03, 0x01, 0xB7, 0x00, 0x84,
+  0x03, 0x01, 0x01, 0x03, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x84, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x8C, 0x01, 0x00, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x03, 0x82, 0x01,
+  0x06, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x82, 0x01, 0x05, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0xB7, 0x00, 0x00,
+  0x03, 0x82, 0x01, 0x01, 0x03, 0x01, 0x84, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x84, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x82, 0x01, 0x01, 0x03, 0x03, 0x87, 0x01, 0x06, 0x03, 0x01, 0x03, 0x01,
+  0x03, 0x01, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x03, 0x86, 0x01, 0x00,
+  0x03, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x01, 0x03, 0x01, 0xB7, 0x00,
+  0x00, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x03, 0x86, 0x01, 0x00, 0x03,
+  0x84, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03, 0x82, 0x01, 0x00, 0x03,
+  0x82, 0x01, 0x01, 0x03, 0x03, 0x87, 0x01, 0x06, 0x03, 0x01, 0x03, 0x01,
+  0x03, 0x01, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x03, 0x86, 0x01, 0x00,
+  0x03, 0x82, 0x01, 0x05, 0x03, 0x01, 0x01, 0x03, 0x03, 0x01, 0xB7, 0x00,
+  0x00, 0x03, 0x82, 0x01, 0x02, 0x03, 0x01, 0x01, 0x82, 0x03, 0x82, 0x01,
+  0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x83, 0x01,
+  0x00, 0x03, 0x89, 0x01, 0x02, 0x03, 0x01, 0x03, 0x82, 0x01, 0x82, 0x03,
+  0x02, 0x01, 0x01, 0x03, 0x85, 0x01, 0x82, 0x03, 0x82, 0x01, 0x04, 0x03,
+  0x03, 0x01, 0x03, 0x01, 0xB7, 0x00, 0x9E, 0x01, 0x00, 0x03, 0xA7, 0x01,
+  0xF7, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x01,
+  0x01, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B,
+  0x0B, 0x0C, 0x0C, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x0D, 0x0D,
+  0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13,
+  0x14, 0x14, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x15, 0x15, 0x16,
+  0x16, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C,
+  0x1C, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x1D, 0x1D, 0x1E, 0x1E,
+  0x1F, 0x1F, 0x20, 0x20, 0x21, 0x21, 0x22, 0x22, 0x23, 0x23, 0x24, 0x24,
+  0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x25, 0x25, 0x26, 0x26, 0x27,
+  0x27, 0x28, 0x28, 0x29, 0x29, 0x2A, 0x2A, 0x2B, 0x2B, 0x2C, 0x2C, 0xCB,
+  0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x2D, 0x2D, 0x2E, 0x2E, 0x2F, 0x2F,
+  0x30, 0x30, 0x31, 0x31, 0x32, 0x32, 0x33, 0x33, 0x34, 0x34, 0xCB, 0x00,
+  0x00, 0x03, 0xA2, 0x00, 0x0F, 0x35, 0x35, 0x36, 0x36, 0x37, 0x37, 0x38,
+  0x38, 0x39, 0x39, 0x3A, 0x3A, 0x3B, 0x3B, 0x3C, 0x3C, 0xCB, 0x00, 0x00,
+  0x03, 0xA2, 0x00, 0x0F, 0x3D, 0x3D, 0x3E, 0x3E, 0x3F, 0x3F, 0x40, 0x40,
+  0x41, 0x41, 0x42, 0x42, 0x43, 0x43, 0x44, 0x44, 0xCB, 0x00, 0x00, 0x03,
+  0xA2, 0x00, 0x0F, 0x45, 0x45, 0x46, 0x46, 0x47, 0x47, 0x48, 0x48, 0x49,
+  0x49, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0xCB, 0x00, 0x00, 0x03, 0xA2,
+  0x00, 0x0F, 0x4D, 0x4D, 0x4E, 0x4E, 0x4F, 0x4F, 0x50, 0x50, 0x51, 0x51,
+  0x52, 0x52, 0x53, 0x53, 0x54, 0x54, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00,
+  0x0F, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58, 0x58, 0x59, 0x59, 0x5A,
+  0x5A, 0x5B, 0x5B, 0x5C, 0x5C, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F,
+  0x5D, 0x5D, 0x5E, 0x5E, 0x5F, 0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62,
+  0x63, 0x63, 0x64, 0x64, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x65,
+  0x65, 0x66, 0x66, 0x67, 0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B,
+  0x6B, 0x6C, 0x6C, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x6D, 0x6D,
+  0x6E, 0x6E, 0x6F, 0x6F, 0x70, 0x70, 0x71, 0x71, 0x72, 0x72, 0x73, 0x73,
+  0x74, 0x74, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x75, 0x75, 0x76,
+  0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x7A, 0x7A, 0x7B, 0x7B, 0x7C,
+  0x7C, 0xCB, 0x00, 0x00, 0x03, 0xA2, 0x00, 0x0F, 0x04, 0x04, 0x7D, 0x7D,
+  0x7E, 0x7E, 0x7F, 0x7F, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x05, 0x05,
+  0xCB, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0x03, 0xBE, 0x00,
+};
+const ST7735_RLEImage_t Splash = {128, 160, 131, Splash_palette, Splash_data};
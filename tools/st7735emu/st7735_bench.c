@@ -0,0 +1,189 @@
+// st7735_bench.c
+// Runs on the host (Linux)
+// Drives the unchanged inc/ST7735.c against the emulated panel and
+// reports the SPI bytes, commands and address windows each API call
+// costs.  At the 8 MHz SSI0 clock of ST7735_InitR one byte takes 1 us,
+// so bytes are also microseconds of bus time.  Build and run with
+//   gcc -O2 -o st7735_bench -include tools/st7735emu/mock.h -DST7735_DMA=0
+//       inc/ST7735.c tools/st7735emu/st7735emu.c tools/st7735emu/st7735_bench.c
+//       tools/st7735emu/splash_rle.c
+//   ./st7735_bench                          print the table
+//   ./st7735_bench --snap DIR               also save DIR/<step>.png and .ppm
+//   ./st7735_bench --check tools/st7735emu/costs.txt
+// --check exits with 1 if any call sends more bytes or commands than the
+// baseline file lists, so CI catches a driver change that costs bus time.
+// Regenerate the baseline with  ./st7735_bench > tools/st7735emu/costs.txt
+// splash_rle.c is the DrawBitmap_16x16 snapshot run through
+// tools/rle_convert.py; the bench checks ST7735_DrawBitmapRLE against a
+// plain decoder of the same runs.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../inc/ST7735.h"
+#include "st7735emu.h"
+
+#define MAXSTEPS 32
+
+typedef struct{
+  char name[32];
+  uint32_t bytes, commands, windows, pixels;
+} Step_t;
+
+static Step_t Steps[MAXSTEPS];
+static uint32_t NumSteps;
+static const char *SnapDir;
+static uint32_t RleBad;                 // wrong pixels from DrawBitmapRLE
+static uint16_t Image[16*16];
+static uint16_t Decoded[EMU_HEIGHT][EMU_WIDTH];
+extern const ST7735_RLEImage_t Splash;
+
+// record the cost of everything sent since the previous step
+static void step(const char *name){
+  const EmuCounts_t *c = ST7735Emu_Counts();
+  Step_t *s = &Steps[NumSteps++];
+  strncpy(s->name, name, sizeof(s->name)-1);
+  s->bytes = c->bytes;
+  s->commands = c->commands;
+  s->windows = c->windows;
+  s->pixels = c->pixels;
+  if(SnapDir){
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.png", SnapDir, name);
+    ST7735Emu_WritePNG(path);
+    snprintf(path, sizeof(path), "%s/%s.ppm", SnapDir, name);
+    ST7735Emu_WritePPM(path);
+  }
+  ST7735Emu_ClearCounts();
+}
+
+// straightforward decoder of the format described in ST7735.h
+static void rleReference(const ST7735_RLEImage_t *image, uint16_t *out){
+  const uint8_t *pt = image->data;
+  uint32_t n = 0, total = image->width*image->height, k;
+  while(n < total){
+    uint8_t code = *pt++;
+    if(code&0x80){
+      for(k = 0; k <= (code&0x7Fu); k++) out[n++] = image->palette[*pt];
+      pt++;
+    } else{
+      for(k = 0; k <= code; k++) out[n++] = image->palette[*pt++];
+    }
+  }
+}
+
+// count screen pixels in the rectangle that differ from the reference
+// drawn with its top left corner at (x0,y0)
+static uint32_t rleMismatches(int x0, int y0){
+  uint32_t bad = 0;
+  int x, y;
+  for(y = 0; y < EMU_HEIGHT; y++){
+    for(x = 0; x < EMU_WIDTH; x++){
+      int ix = x - x0, iy = y - y0;
+      if((ix < 0) || (iy < 0) || (ix >= Splash.width) || (iy >= Splash.height)) continue;
+      if(ST7735Emu_Pixel(x, y) != Decoded[iy][ix]) bad++;
+    }
+  }
+  return bad;
+}
+
+// compare against a baseline written by an earlier run
+static int check(const char *path){
+  FILE *f = fopen(path, "r");
+  char line[160], name[32];
+  unsigned bytes, commands;
+  uint32_t i, found;
+  int fails = 0;
+  if(!f){
+    printf("cannot open %s\n", path);
+    return 1;
+  }
+  while(fgets(line, sizeof(line), f)){
+    if(sscanf(line, "%31s %u %u", name, &bytes, &commands) != 3) continue;
+    found = 0;
+    for(i = 0; i < NumSteps; i++){
+      if(strcmp(Steps[i].name, name)) continue;
+      found = 1;
+      if((Steps[i].bytes > bytes) || (Steps[i].commands > commands)){
+        printf("FAIL %s: %u bytes %u commands, baseline %u %u\n", name,
+               Steps[i].bytes, Steps[i].commands, bytes, commands);
+        fails++;
+      }
+    }
+    if(!found){
+      printf("FAIL %s: step no longer measured\n", name);
+      fails++;
+    }
+  }
+  fclose(f);
+  printf("%s\n", fails? "cost check failed": "cost check passed");
+  return fails != 0;
+}
+
+int main(int argc, char **argv){
+  const char *baseline = 0;
+  uint32_t i;
+  int a;
+  for(a = 1; a < argc-1; a++){
+    if(!strcmp(argv[a], "--snap")) SnapDir = argv[++a];
+    else if(!strcmp(argv[a], "--check")) baseline = argv[++a];
+  }
+  if(ST7735Emu_Init()){
+    printf("cannot map the peripheral space at 0x40000000\n");
+    return 2;
+  }
+  for(i = 0; i < 16*16; i++){
+    Image[i] = ST7735_Color565(i*16, 255-i, (i%16)*16);
+  }
+
+  rleReference(&Splash, &Decoded[0][0]);
+
+  Output_Init();                        step("Output_Init");
+  ST7735_FillScreen(ST7735_BLUE);       step("FillScreen");
+  ST7735_FillRect(10, 20, 40, 30, ST7735_RED); step("FillRect_40x30");
+  ST7735_DrawPixel(5, 5, ST7735_WHITE); step("DrawPixel");
+  ST7735_DrawFastHLine(0, 60, 128, ST7735_YELLOW); step("DrawFastHLine_128");
+  ST7735_DrawFastVLine(64, 0, 160, ST7735_YELLOW); step("DrawFastVLine_160");
+  ST7735_DrawChar(0, 70, 'A', ST7735_WHITE, ST7735_BLACK, 1); step("DrawChar_miss");
+  ST7735_DrawChar(6, 70, 'A', ST7735_WHITE, ST7735_BLACK, 1); step("DrawChar_hit");
+  ST7735_DrawChar(12, 70, 'B', ST7735_WHITE, ST7735_BLACK, 2); step("DrawChar_size2");
+  ST7735_DrawCharS(30, 70, 'C', ST7735_WHITE, ST7735_BLACK, 1); step("DrawCharS");
+  ST7735_DrawString(0, 9, "0123456789abcdefghijk", ST7735_GREEN); step("DrawString_21");
+  ST7735_SetCursor(0, 11);
+  ST7735_OutString("Hello, world");  step("OutString_12");
+  ST7735_DrawBitmap(100, 140, Image, 16, 16); step("DrawBitmap_16x16");
+
+  ST7735_DrawBitmapRLE(0, 159, &Splash); step("DrawBitmapRLE_128x160");
+  RleBad = rleMismatches(0, 0);
+  ST7735_DrawBitmapRLE(-20, 120, &Splash); step("DrawBitmapRLE_clipped");
+  RleBad += rleMismatches(-20, 120-159);
+
+  // the Display.c console: fixed title row, rows 1-15 scroll
+  ST7735_FillScreen(ST7735_BLACK);      step("FillScreen_black");
+  ST7735_SetScrollArea(10, 0);          step("SetScrollArea");
+  ST7735_SetScrollStart(10);            step("SetScrollStart");
+  ST7735_DrawString(0, 0, "UART Log:", ST7735_GREEN);
+  for(i = 1; i <= 15; i++){
+    char line[8];
+    snprintf(line, sizeof(line), "line %u", i);
+    ST7735_DrawString(0, i, line, ST7735_GREEN);
+  }
+  step("Console_full");
+  ST7735_SetScrollStart(20);            // line 1 leaves the top, its slot
+  ST7735_FillRect(0, 10, 128, 10, ST7735_BLACK); // is reused at the bottom
+  ST7735_DrawString(0, 1, "line 16", ST7735_GREEN);
+  step("Console_newline");
+
+  printf("%-20s %8s %8s %8s %8s %10s\n", "# step", "bytes", "commands",
+         "windows", "pixels", "us@8MHz");
+  for(i = 0; i < NumSteps; i++){
+    printf("%-20s %8u %8u %8u %8u %10u\n", Steps[i].name, Steps[i].bytes,
+           Steps[i].commands, Steps[i].windows, Steps[i].pixels, Steps[i].bytes);
+  }
+  if(RleBad){
+    printf("FAIL DrawBitmapRLE: %u pixels differ from the reference decoder\n", RleBad);
+    return 1;
+  }
+  return baseline? check(baseline): 0;
+}
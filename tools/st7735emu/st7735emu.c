@@ -0,0 +1,290 @@
+// st7735emu.c
+// Runs on the host (Linux)
+// Emulated ST7735R panel behind a mocked SSI0, see st7735emu.h and mock.h
+// The frame memory is addressed the way the controller does it: CASET
+// and RASET set a window in the MADCTL-mapped (logical) coordinates,
+// RAMWR pixels fill it left to right, top to bottom.  The panel scans
+// frame memory with the vertical scroll (VSCRDEF/VSCSAD) applied.  It is
+// mounted so that rotation 0 (MX and MY set, as ST7735_InitR leaves it)
+// reads upright, which is what the snapshots show.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "../../inc/tm4c123gh6pm.h"
+#include "st7735emu.h"
+
+#define PERIPH_BASE 0x40000000UL
+#define PERIPH_SIZE 0x00100000UL
+#define DR_IDLE     0xFFFFFFFFu     // no byte waiting in SSI0_DR_R
+#define DC_PIN      (*((volatile uint32_t *)0x40004100)) // PA6, as in ST7735.c
+#define SSI_SR_TFE  0x00000001
+#define SSI_SR_TNF  0x00000002
+
+#define MADCTL_MY  0x80
+#define MADCTL_MX  0x40
+#define MADCTL_MV  0x20
+#define MADCTL_BGR 0x08
+
+static uint16_t Mem[EMU_HEIGHT][EMU_WIDTH]; // frame memory, [row][column]
+static EmuCounts_t Counts;
+static volatile uint32_t StatusReg = SSI_SR_TFE|SSI_SR_TNF;
+
+static uint8_t Cmd;                 // command whose parameters are coming
+static uint32_t Param;              // parameter bytes received
+static uint8_t Params[8];
+static uint16_t Xs, Xe, Ys, Ye;     // address window
+static uint16_t Cx, Cy;             // RAMWR position
+static uint16_t PixelHi;            // first byte of a pixel, or 0xFFFF
+static uint8_t Madctl, Inverted, DisplayOn;
+static uint16_t Tfa, Vsa, Bfa, Ssa; // vertical scroll definition and start
+
+static void reset(void){
+  Cmd = 0;
+  Param = 0;
+  Xs = 0; Xe = EMU_WIDTH-1;
+  Ys = 0; Ye = EMU_HEIGHT-1;
+  Cx = Cy = 0;
+  PixelHi = 0xFFFF;
+  Madctl = 0;
+  Inverted = 0;
+  DisplayOn = 0;
+  Tfa = 0; Vsa = EMU_HEIGHT; Bfa = 0; Ssa = 0;
+}
+
+// store one pixel at the RAMWR position and advance it
+static void writePixel(uint16_t color){
+  int a = Cx, b = Cy;               // logical column and row
+  if(Madctl&MADCTL_MV){
+    a = Cy;
+    b = Cx;
+  }
+  if(Madctl&MADCTL_MX) a = EMU_WIDTH-1-a;
+  if(Madctl&MADCTL_MY) b = EMU_HEIGHT-1-b;
+  if((a >= 0) && (a < EMU_WIDTH) && (b >= 0) && (b < EMU_HEIGHT)){
+    Mem[b][a] = color;
+  }
+  Counts.pixels++;
+  if(Cx < Xe){
+    Cx++;
+  } else{
+    Cx = Xs;
+    Cy = (Cy < Ye)? Cy+1: Ys;
+  }
+}
+
+// a parameter list is complete
+static void applyParams(void){
+  switch(Cmd){
+    case 0x2A: Xs = (Params[0]<<8)|Params[1]; Xe = (Params[2]<<8)|Params[3]; break;
+    case 0x2B: Ys = (Params[0]<<8)|Params[1]; Ye = (Params[2]<<8)|Params[3];
+               Counts.windows++; break;
+    case 0x36: Madctl = Params[0]; break;
+    case 0x33: Tfa = (Params[0]<<8)|Params[1];
+               Vsa = (Params[2]<<8)|Params[3];
+               Bfa = (Params[4]<<8)|Params[5]; break;
+    case 0x37: Ssa = (Params[0]<<8)|Params[1]; break;
+  }
+}
+
+static uint32_t paramCount(uint8_t cmd){
+  switch(cmd){
+    case 0x2A: case 0x2B: return 4;
+    case 0x36: case 0x3A: return 1;
+    case 0x33: return 6;
+    case 0x37: return 2;
+  }
+  return 0;                         // others: parameters ignored
+}
+
+// one byte on the bus, dc is the D/C pin (nonzero for data)
+static void busByte(uint8_t b, uint32_t dc){
+  Counts.bytes++;
+  if(dc == 0){
+    Counts.commands++;
+    Counts.cmd[b]++;
+    Cmd = b;
+    Param = 0;
+    switch(b){
+      case 0x01: reset(); Cmd = b; break;       // SWRESET
+      case 0x20: Inverted = 0; break;           // INVOFF
+      case 0x21: Inverted = 1; break;           // INVON
+      case 0x28: DisplayOn = 0; break;          // DISPOFF
+      case 0x29: DisplayOn = 1; break;          // DISPON
+      case 0x2C: Cx = Xs; Cy = Ys; PixelHi = 0xFFFF; break; // RAMWR
+    }
+    return;
+  }
+  if(Cmd == 0x2C){
+    if(PixelHi == 0xFFFF){
+      PixelHi = b;
+    } else{
+      writePixel((PixelHi<<8)|b);
+      PixelHi = 0xFFFF;
+    }
+    return;
+  }
+  if(Param < sizeof(Params)){
+    Params[Param] = b;
+  }
+  Param++;
+  if(Param == paramCount(Cmd)){
+    applyParams();
+  }
+}
+
+// called by the driver in place of reading SSI0_SR_R
+volatile uint32_t *ST7735Emu_SSI0SR(void){
+  uint32_t data = SSI0_DR_R;
+  if(data != DR_IDLE){
+    uint32_t dc = DC_PIN&0x40;
+    if((SSI0_CR0_R&0x0F) == 0x0F){  // 16-bit frames
+      busByte(data>>8, dc);
+      busByte(data, dc);
+    } else{
+      busByte(data, dc);
+    }
+    SSI0_DR_R = DR_IDLE;
+  }
+  return &StatusReg;
+}
+
+int ST7735Emu_Init(void){
+  void *pt = mmap((void *)PERIPH_BASE, PERIPH_SIZE, PROT_READ|PROT_WRITE,
+                  MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if(pt != (void *)PERIPH_BASE){
+    if(pt != MAP_FAILED) munmap(pt, PERIPH_SIZE);
+    return -1;
+  }
+  SYSCTL_PRGPIO_R = 0xFFFFFFFF;     // every port reports ready
+  SSI0_DR_R = DR_IDLE;
+  memset(Mem, 0, sizeof(Mem));
+  reset();
+  ST7735Emu_ClearCounts();
+  return 0;
+}
+
+const EmuCounts_t *ST7735Emu_Counts(void){
+  ST7735Emu_SSI0SR();               // take a byte still in the data register
+  return &Counts;
+}
+
+void ST7735Emu_ClearCounts(void){
+  ST7735Emu_SSI0SR();
+  memset(&Counts, 0, sizeof(Counts));
+}
+
+uint16_t ST7735Emu_Pixel(int x, int y){
+  int scan = EMU_HEIGHT-1-y;        // panel scan line, mounted upside down
+  int row = scan;
+  uint16_t color;
+  if((scan >= Tfa) && (scan < Tfa+Vsa) && Vsa){
+    row = Tfa + ((Ssa - Tfa) + (scan - Tfa))%Vsa;
+  }
+  color = Mem[row][EMU_WIDTH-1-x];
+  if(Inverted) color = ~color;
+  if(!DisplayOn) color = 0;
+  return color;
+}
+
+// 8-bit red, green, blue of a screen pixel
+static void rgb(int x, int y, uint8_t *out){
+  uint16_t c = ST7735Emu_Pixel(x, y);
+  uint8_t r = c>>11, g = (c>>5)&0x3F, b = c&0x1F;
+  if(Madctl&MADCTL_BGR){            // panel wired for BGR order
+    uint8_t t = r; r = b; b = t;
+  }
+  out[0] = (r<<3)|(r>>2);
+  out[1] = (g<<2)|(g>>4);
+  out[2] = (b<<3)|(b>>2);
+}
+
+int ST7735Emu_WritePPM(const char *path){
+  FILE *f = fopen(path, "wb");
+  uint8_t px[3];
+  int x, y;
+  if(!f) return -1;
+  ST7735Emu_SSI0SR();
+  fprintf(f, "P6\n%d %d\n255\n", EMU_WIDTH, EMU_HEIGHT);
+  for(y = 0; y < EMU_HEIGHT; y++){
+    for(x = 0; x < EMU_WIDTH; x++){
+      rgb(x, y, px);
+      fwrite(px, 1, 3, f);
+    }
+  }
+  return fclose(f);
+}
+
+// PNG pieces: CRC-32 over chunks, Adler-32 over the zlib data
+static uint32_t crc32(uint32_t crc, const uint8_t *p, uint32_t n){
+  uint32_t k;
+  crc = ~crc;
+  while(n--){
+    crc ^= *p++;
+    for(k = 0; k < 8; k++){
+      crc = (crc>>1)^(0xEDB88320u&(0u-(crc&1)));
+    }
+  }
+  return ~crc;
+}
+
+static void put32(uint8_t *p, uint32_t v){
+  p[0] = v>>24; p[1] = v>>16; p[2] = v>>8; p[3] = v;
+}
+
+static void chunk(FILE *f, const char *type, const uint8_t *data, uint32_t n){
+  uint8_t head[8];
+  uint32_t crc;
+  put32(head, n);
+  memcpy(&head[4], type, 4);
+  fwrite(head, 1, 8, f);
+  if(n) fwrite(data, 1, n, f);
+  crc = crc32(crc32(0, (const uint8_t *)type, 4), data, n);
+  put32(head, crc);
+  fwrite(head, 1, 4, f);
+}
+
+int ST7735Emu_WritePNG(const char *path){
+  static const uint8_t sig[8] = {0x89,'P','N','G','\r','\n',0x1A,'\n'};
+  enum{ ROW = 1 + 3*EMU_WIDTH, RAW = ROW*EMU_HEIGHT };
+  static uint8_t raw[RAW];
+  static uint8_t z[2 + RAW + 5*(RAW/65535 + 1) + 4];
+  uint8_t ihdr[13];
+  uint32_t n = 0, i, len, a = 1, b = 0;
+  int x, y;
+  FILE *f = fopen(path, "wb");
+  if(!f) return -1;
+  ST7735Emu_SSI0SR();
+  for(y = 0; y < EMU_HEIGHT; y++){
+    raw[y*ROW] = 0;                 // filter: none
+    for(x = 0; x < EMU_WIDTH; x++){
+      rgb(x, y, &raw[y*ROW + 1 + 3*x]);
+    }
+  }
+  z[n++] = 0x78; z[n++] = 0x01;     // zlib header, no compression
+  for(i = 0; i < RAW; i += len){    // stored deflate blocks
+    len = (RAW - i > 65535)? 65535: RAW - i;
+    z[n++] = (i + len == RAW);      // BFINAL
+    z[n++] = len; z[n++] = len>>8;
+    z[n++] = ~len; z[n++] = (~len)>>8;
+    memcpy(&z[n], &raw[i], len);
+    n += len;
+  }
+  for(i = 0; i < RAW; i++){
+    a = (a + raw[i])%65521;
+    b = (b + a)%65521;
+  }
+  put32(&z[n], (b<<16)|a);
+  n += 4;
+  put32(ihdr, EMU_WIDTH);
+  put32(&ihdr[4], EMU_HEIGHT);
+  ihdr[8] = 8;                      // bits per sample
+  ihdr[9] = 2;                      // truecolor
+  ihdr[10] = ihdr[11] = ihdr[12] = 0;
+  fwrite(sig, 1, 8, f);
+  chunk(f, "IHDR", ihdr, 13);
+  chunk(f, "IDAT", z, n);
+  chunk(f, "IEND", 0, 0);
+  return fclose(f);
+}
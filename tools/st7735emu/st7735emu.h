@@ -0,0 +1,57 @@
+// st7735emu.h
+// Runs on the host (Linux)
+// Emulated ST7735R panel (red tab, 128x160, 16-bit color) behind a
+// mocked SSI0, for running and measuring inc/ST7735.c off-target.
+// The driver is compiled unchanged with -include tools/st7735emu/mock.h,
+// see st7735_bench.c for the build line.
+// Emulated commands: SWRESET, SLPOUT, NORON, INVON/INVOFF, DISPON/DISPOFF,
+// CASET, RASET, RAMWR, MADCTL (MX, MY, MV), COLMOD, VSCRDEF, VSCSAD.
+// Other commands are counted and their parameters ignored.
+// uDMA is not emulated, so build the driver with ST7735_DMA 0.
+
+#ifndef __ST7735EMU_H__
+#define __ST7735EMU_H__
+#include <stdint.h>
+
+#define EMU_WIDTH  128
+#define EMU_HEIGHT 160
+
+typedef struct{
+  uint32_t bytes;        // bytes sent over SSI0
+  uint32_t commands;     // command bytes (D/C low)
+  uint32_t windows;      // CASET+RASET pairs (address windows)
+  uint32_t pixels;       // pixels written to frame memory
+  uint32_t cmd[256];     // times each command was sent
+} EmuCounts_t;
+
+//------------ST7735Emu_Init------------
+// Map the peripheral space and reset the panel and the counters
+// Call once, before ST7735_InitR or Output_Init
+// Output: 0 on success, -1 if the address range could not be mapped
+int ST7735Emu_Init(void);
+
+//------------ST7735Emu_Counts------------
+// Counters since the last ST7735Emu_ClearCounts
+const EmuCounts_t *ST7735Emu_Counts(void);
+
+//------------ST7735Emu_ClearCounts------------
+void ST7735Emu_ClearCounts(void);
+
+//------------ST7735Emu_Pixel------------
+// Color of a pixel as seen on the screen (after scrolling and inversion)
+// Input: x 0 to 127 from the left, y 0 to 159 from the top, as the
+//        driver sees them in rotation 0
+// Output: 16-bit 565 color
+uint16_t ST7735Emu_Pixel(int x, int y);
+
+//------------ST7735Emu_WritePPM------------
+// Save what the screen shows as a binary PPM (P6) file
+// Output: 0 on success
+int ST7735Emu_WritePPM(const char *path);
+
+//------------ST7735Emu_WritePNG------------
+// Save what the screen shows as a PNG file (uncompressed deflate)
+// Output: 0 on success
+int ST7735Emu_WritePNG(const char *path);
+
+#endif